@@ -53,6 +53,7 @@ benchmark_option(OUTPUT_DIR "${CMAKE_BINARY_DIR}/bin")
 benchmark_option(BUILD_HELLO_WORLD OFF)
 benchmark_option(GENERATE_DOCS ON)
 benchmark_option(BUILD_TOOLS ON)
+benchmark_option(BUILD_UNIT_TESTS ON)
 benchmark_option(LOG_BENCHMARK_TARGETS OFF)
 benchmark_option(ALLOW_WARNINGS OFF)
 
@@ -22,8 +22,8 @@ static TestResult run(const UsmMemoryAllocationArguments &arguments, Statistics
         return TestResult::Nooped;
     }
 
-    // Setup
-    LevelZero levelzero;
+    // Setup. Allocations are pooled per context, so memory left cached by previous tests would skew the results
+    LevelZero levelzero{ContextProperties::create().requirePristineContext()};
     Timer timer;
 
     // Warmup
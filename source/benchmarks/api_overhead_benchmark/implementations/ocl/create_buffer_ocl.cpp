@@ -22,8 +22,8 @@ static TestResult run(const CreateBufferArguments &arguments, Statistics &statis
         return TestResult::Nooped;
     }
 
-    // Setup
-    Opencl opencl;
+    // Setup. Allocations are pooled per context, so memory left cached by previous tests would skew the results
+    Opencl opencl(QueueProperties::create(), ContextProperties::create().requirePristineContext());
     Timer timer;
     cl_int retVal{};
     cl_mem_flags memFlags{};
@@ -38,4 +38,8 @@ struct OneAtomic : TestCase<OneAtomicArguments> {
     std::string getHelp() const override {
         return "enqueues kernel performing an atomic operation on a single address";
     }
+
+    Autotuner::Objective getAutotuneObjective() const override {
+        return Autotuner::Objective::PerWorkItem;
+    }
 };
@@ -44,4 +44,8 @@ struct OneAtomicExplicit : TestCase<OneAtomicExplicitArguments> {
     std::string getHelp() const override {
         return "enqueues kernel performing an atomic operation on a single address using OpenCL 2.0 Atomics with explicit memory order and scope";
     }
+
+    Autotuner::Objective getAutotuneObjective() const override {
+        return Autotuner::Objective::PerWorkItem;
+    }
 };
@@ -51,4 +51,8 @@ struct SeparateAtomics : TestCase<SeparateAtomicsArguments> {
     std::string getHelp() const override {
         return "enqueues kernel performing an atomic operation on different addresses";
     }
+
+    Autotuner::Objective getAutotuneObjective() const override {
+        return Autotuner::Objective::PerWorkItem;
+    }
 };
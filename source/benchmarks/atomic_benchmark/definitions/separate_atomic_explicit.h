@@ -57,4 +57,8 @@ struct SeparateAtomicsExplicit : TestCase<SeparateAtomicsExplicitArguments> {
     std::string getHelp() const override {
         return "enqueues kernel performing an atomic operation on different addresses";
     }
+
+    Autotuner::Objective getAutotuneObjective() const override {
+        return Autotuner::Objective::PerWorkItem;
+    }
 };
@@ -11,6 +11,6 @@
 #include "framework/utility/execute_at_app_init.h"
 
 EXECUTE_AT_APP_INIT {
-    DeviceInfo::registerFunctions(Api::L0, L0::printDeviceInfo, L0::printAvailableDevices);
+    DeviceInfo::registerFunctions(Api::L0, L0::printDeviceInfo, L0::printAvailableDevices, L0::getMaxWorkgroupSize);
     SupportedApis::registerSupportedApi(Api::L0);
 };
@@ -11,6 +11,6 @@
 #include "framework/utility/execute_at_app_init.h"
 
 EXECUTE_AT_APP_INIT {
-    DeviceInfo::registerFunctions(Api::OpenCL, OCL::printDeviceInfo, OCL::printAvailableDevices);
+    DeviceInfo::registerFunctions(Api::OpenCL, OCL::printDeviceInfo, OCL::printAvailableDevices, OCL::getMaxWorkgroupSize);
     SupportedApis::registerSupportedApi(Api::OpenCL);
 };
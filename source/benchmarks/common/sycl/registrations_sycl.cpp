@@ -12,6 +12,6 @@
 #include "framework/utility/execute_at_app_init.h"
 
 EXECUTE_AT_APP_INIT {
-    DeviceInfo::registerFunctions(Api::SYCL, SYCL::printDeviceInfo, SYCL::printAvailableDevices);
+    DeviceInfo::registerFunctions(Api::SYCL, SYCL::printDeviceInfo, SYCL::printAvailableDevices, SYCL::getMaxWorkgroupSize);
     SupportedApis::registerSupportedApi(Api::SYCL);
 };
@@ -38,4 +38,8 @@ struct DoMathOperation : TestCase<DoMathOperationArguments> {
     std::string getHelp() const override {
         return "enqueues kernel performing a math operation";
     }
+
+    Autotuner::Objective getAutotuneObjective() const override {
+        return Autotuner::Objective::TimeOfLaunch;
+    }
 };
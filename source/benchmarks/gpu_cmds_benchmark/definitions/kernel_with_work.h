@@ -36,4 +36,8 @@ struct KernelWithWork : TestCase<KernelWithWorkArguments> {
     std::string getHelp() const override {
         return "measures time required to run a GPU kernel which assigns values to elements of a buffer.";
     }
+
+    Autotuner::Objective getAutotuneObjective() const override {
+        return Autotuner::Objective::TimeOfLaunch;
+    }
 };
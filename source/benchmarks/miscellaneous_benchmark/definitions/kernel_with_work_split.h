@@ -39,6 +39,10 @@ struct KernelWithWorkSplit : TestCase<KernelWithWorkArgumentsSplit> {
         return "measures time required to run a GPU kernel which assigns constant values to "
                "elements of a buffer. Each thread assigns one value. Benchmark checks the impact of kernel split.";
     }
+
+    Autotuner::Objective getAutotuneObjective() const override {
+        return Autotuner::Objective::TimeOfLaunch;
+    }
 };
 
 inline auto selectKernel(WorkItemIdUsage usedIds, const char *extension) {
@@ -11,6 +11,7 @@
 #include "framework/test_case/register_test_case.h"
 #include "framework/utility/file_helper.h"
 #include "framework/utility/timer.h"
+#include "framework/utility/wait_helper.h"
 
 #include "definitions/immediate_cmdlist_submission.h"
 
@@ -41,8 +42,7 @@ static void issueToImmediateCmdList(ThreadSpecificData *threadData, std::shared_
     std::shared_lock sharedLock(*barrier);
     threadData->timer.measureStart();
     zeCommandListAppendLaunchKernel(threadData->cmdList, threadData->kernel, &groupCount, threadData->event, 0, nullptr);
-    while (*volatileBuffer != 1) {
-    }
+    WaitHelper::waitUntilEqual(volatileBuffer, 1);
     threadData->timer.measureEnd();
     zeEventHostSynchronize(threadData->event, std::numeric_limits<uint64_t>::max());
 }
@@ -35,6 +35,10 @@ struct KernelWithWorkImmediate : TestCase<KernelWithWorkImmediateArguments> {
         return "measures time required to run a GPU kernel which assigns constant values to "
                "elements of a buffer using immediate command list. Each thread assigns one value.";
     }
+
+    Autotuner::Objective getAutotuneObjective() const override {
+        return Autotuner::Objective::TimeOfLaunch;
+    }
 };
 
 inline auto selectKernel(WorkItemIdUsage usedIds, const char *extension) {
@@ -8,6 +8,7 @@
 #include "framework/l0/levelzero.h"
 #include "framework/test_case/register_test_case.h"
 #include "framework/utility/timer.h"
+#include "framework/utility/wait_helper.h"
 
 #include "definitions/best_submission.h"
 
@@ -53,8 +54,7 @@ static TestResult run(const BestSubmissionArguments &arguments, Statistics &stat
 
         timer.measureStart();
         ASSERT_ZE_RESULT_SUCCESS(zeCommandQueueExecuteCommandLists(levelzero.commandQueue, 1, &cmdList, nullptr));
-        while (*volatileBuffer == timestampInitial) {
-        }
+        WaitHelper::waitWhileEqual(volatileBuffer, timestampInitial);
         timer.measureEnd();
         statistics.pushValue(timer.get(), typeSelector.getUnit(), typeSelector.getType());
 
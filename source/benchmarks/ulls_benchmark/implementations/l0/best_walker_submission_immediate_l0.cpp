@@ -9,6 +9,7 @@
 #include "framework/test_case/register_test_case.h"
 #include "framework/utility/file_helper.h"
 #include "framework/utility/timer.h"
+#include "framework/utility/wait_helper.h"
 
 #include "definitions/best_walker_submission_immediate.h"
 
@@ -87,8 +88,7 @@ static TestResult run(const BestWalkerSubmissionImmediateArguments &arguments, S
 
         timer.measureStart();
         ASSERT_ZE_RESULT_SUCCESS(zeCommandListAppendLaunchKernel(cmdList, kernel, &groupCount, event, 0, nullptr));
-        while (*volatileBuffer != 1) {
-        }
+        WaitHelper::waitUntilEqual(volatileBuffer, 1);
         timer.measureEnd();
 
         ASSERT_ZE_RESULT_SUCCESS(zeEventHostSynchronize(event, std::numeric_limits<uint64_t>::max()));
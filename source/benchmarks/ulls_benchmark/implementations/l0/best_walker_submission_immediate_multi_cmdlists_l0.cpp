@@ -9,6 +9,7 @@
 #include "framework/test_case/register_test_case.h"
 #include "framework/utility/file_helper.h"
 #include "framework/utility/timer.h"
+#include "framework/utility/wait_helper.h"
 
 #include "definitions/best_walker_submission_immediate_multi_cmdlists.h"
 
@@ -101,8 +102,7 @@ static TestResult run(const BestWalkerSubmissionImmediateMultiCmdlistsArguments
             ASSERT_ZE_RESULT_SUCCESS(zeCommandListAppendLaunchKernel(cmdLists[i], kernels[i], &groupCount, events[i], 0, nullptr));
         }
         for (auto i = 0u; i < arguments.cmdlistCount; i++) {
-            while (*volatileBuffers[i] != 1) {
-            }
+            WaitHelper::waitUntilEqual(volatileBuffers[i], 1);
         }
         timer.measureEnd();
 
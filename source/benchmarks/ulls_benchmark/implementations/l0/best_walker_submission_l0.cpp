@@ -9,6 +9,7 @@
 #include "framework/test_case/register_test_case.h"
 #include "framework/utility/file_helper.h"
 #include "framework/utility/timer.h"
+#include "framework/utility/wait_helper.h"
 
 #include "definitions/best_walker_submission.h"
 
@@ -75,8 +76,7 @@ static TestResult run(const BestWalkerSubmissionArguments &arguments, Statistics
 
         timer.measureStart();
         ASSERT_ZE_RESULT_SUCCESS(zeCommandQueueExecuteCommandLists(levelzero.commandQueue, 1, &cmdList, nullptr));
-        while (*volatileBuffer != 1) {
-        }
+        WaitHelper::waitUntilEqual(volatileBuffer, 1);
         timer.measureEnd();
 
         ASSERT_ZE_RESULT_SUCCESS(zeCommandQueueSynchronize(levelzero.commandQueue, std::numeric_limits<uint64_t>::max()));
@@ -8,6 +8,7 @@
 #include "framework/l0/levelzero.h"
 #include "framework/test_case/register_test_case.h"
 #include "framework/utility/timer.h"
+#include "framework/utility/wait_helper.h"
 
 #include "definitions/completion_latency.h"
 
@@ -52,8 +53,7 @@ static TestResult run(const CompletionLatencyArguments &arguments, Statistics &s
         _mm_clflush(buffer);
 
         ASSERT_ZE_RESULT_SUCCESS(zeCommandQueueExecuteCommandLists(levelzero.commandQueue, 1, &cmdList, nullptr));
-        while (*volatileBuffer == timestampInitial) {
-        }
+        WaitHelper::waitWhileEqual(volatileBuffer, timestampInitial);
         timer.measureStart();
         ASSERT_ZE_RESULT_SUCCESS(zeCommandQueueSynchronize(levelzero.commandQueue, std::numeric_limits<uint64_t>::max()));
         timer.measureEnd();
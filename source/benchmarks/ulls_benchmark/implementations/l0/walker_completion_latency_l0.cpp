@@ -9,6 +9,7 @@
 #include "framework/test_case/register_test_case.h"
 #include "framework/utility/file_helper.h"
 #include "framework/utility/timer.h"
+#include "framework/utility/wait_helper.h"
 
 #include "definitions/walker_completion_latency.h"
 
@@ -88,8 +89,7 @@ static TestResult run(const WalkerCompletionLatencyArguments &arguments, Statist
         _mm_clflush(buffer);
 
         ASSERT_ZE_RESULT_SUCCESS(zeCommandQueueExecuteCommandLists(levelzero.commandQueue, 1, &cmdList, arguments.useFence ? fence : nullptr));
-        while (*volatileBuffer != 1) {
-        }
+        WaitHelper::waitUntilEqual(volatileBuffer, 1);
 
         timer.measureStart();
         if (arguments.useFence) {
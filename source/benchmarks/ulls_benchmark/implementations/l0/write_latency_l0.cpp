@@ -8,6 +8,7 @@
 #include "framework/l0/levelzero.h"
 #include "framework/test_case/register_test_case.h"
 #include "framework/utility/timer.h"
+#include "framework/utility/wait_helper.h"
 
 #include "definitions/write_latency.h"
 
@@ -100,8 +101,7 @@ static TestResult run(const WriteLatencyArguments &arguments, Statistics &statis
 
         timer.measureStart();
         ASSERT_ZE_RESULT_SUCCESS(zeEventHostSignal(hEvent2));
-        while (*volatileBuffer == timestampInitial) {
-        }
+        WaitHelper::waitWhileEqual(volatileBuffer, timestampInitial);
         timer.measureEnd();
 
 #if ADD_ENTER_SUPPORT
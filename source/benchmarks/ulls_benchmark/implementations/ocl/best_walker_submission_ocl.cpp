@@ -8,6 +8,7 @@
 #include "framework/ocl/opencl.h"
 #include "framework/test_case/register_test_case.h"
 #include "framework/utility/timer.h"
+#include "framework/utility/wait_helper.h"
 
 #include "definitions/best_walker_submission.h"
 
@@ -68,8 +69,7 @@ static TestResult run(const BestWalkerSubmissionArguments &arguments, Statistics
         ASSERT_CL_SUCCESS(clFlush(opencl.commandQueue));
         ASSERT_CL_SUCCESS(retVal);
 
-        while (*volatileHostMemory != 1) {
-        }
+        WaitHelper::waitUntilEqual(volatileHostMemory, 1);
         timer.measureEnd();
         statistics.pushValue(timer.get(), typeSelector.getUnit(), typeSelector.getType());
     }
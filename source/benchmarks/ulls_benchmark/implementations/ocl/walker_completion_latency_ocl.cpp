@@ -8,6 +8,7 @@
 #include "framework/ocl/opencl.h"
 #include "framework/test_case/register_test_case.h"
 #include "framework/utility/timer.h"
+#include "framework/utility/wait_helper.h"
 
 #include "definitions/walker_completion_latency.h"
 
@@ -63,8 +64,7 @@ static TestResult run(const WalkerCompletionLatencyArguments &arguments, Statist
 
         ASSERT_CL_SUCCESS(clEnqueueNDRangeKernel(opencl.commandQueue, kernel, 1, nullptr, &gws, &lws, 0, nullptr, nullptr));
         ASSERT_CL_SUCCESS(clFlush(opencl.commandQueue));
-        while (*volatileHostMemory != 1) {
-        }
+        WaitHelper::waitUntilEqual(volatileHostMemory, 1);
 
         timer.measureStart();
         ASSERT_CL_SUCCESS(clFinish(opencl.commandQueue));
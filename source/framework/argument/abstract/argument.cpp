@@ -43,11 +43,15 @@ std::string Argument::getExtraHelp() const {
 void Argument::parse(CommandLineArgument &argument) {
     if (argument.isKeyEqualTo(this->key)) {
         argument.markAsProcessed();
-        parseImpl(argument.getValue());
-        markAsParsed();
+        parseValue(argument.getValue());
     }
 }
 
+void Argument::parseValue(const std::string &value) {
+    parseImpl(value);
+    markAsParsed();
+}
+
 void Argument::markAsParsed() {
     this->parsed = true;
 }
@@ -8,9 +8,12 @@
 #pragma once
 
 #include "framework/utility/error.h"
+#include "framework/utility/string_utils.h"
 
+#include <algorithm>
 #include <sstream>
 #include <string>
+#include <vector>
 
 struct ArgumentContainer;
 class CommandLineArgument;
@@ -30,8 +33,16 @@ struct Argument {
     }
 
     void parse(CommandLineArgument &argument);
+    void parseValue(const std::string &value);
     void markAsParsed();
 
+    // Expands sweep syntax accepted in single test mode, e.g. "32,64,256", into a list of values which can be passed to
+    // parseValue(). Arguments not supporting sweeps return the value unchanged. Returns false for malformed sweeps.
+    virtual bool expandSweep(const std::string &value, std::vector<std::string> &outValues) {
+        outValues = {value};
+        return true;
+    }
+
     virtual bool validate() const {
         return true;
     }
@@ -41,6 +52,11 @@ struct Argument {
     }
 
   protected:
+    static bool expandSweepList(const std::string &value, std::vector<std::string> &outValues) {
+        outValues = splitString(value, ',');
+        return !outValues.empty() && std::find(outValues.begin(), outValues.end(), "") == outValues.end();
+    }
+
     virtual void parseImpl(const std::string &value) = 0;
     virtual std::string toStringValue() const = 0;
     virtual std::string getHelpEntry(const std::string &key) const;
@@ -56,6 +56,10 @@ struct BitfieldEnumArgument : Argument {
         return true;
     }
 
+    bool expandSweep(const std::string &valueToExpand, std::vector<std::string> &outValues) override {
+        return expandSweepList(valueToExpand, outValues);
+    }
+
   protected:
     std::string toStringValue() const override {
         std::ostringstream result{};
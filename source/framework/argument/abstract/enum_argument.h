@@ -36,6 +36,10 @@ struct EnumArgument : Argument {
         return false;
     }
 
+    bool expandSweep(const std::string &valueToExpand, std::vector<std::string> &outValues) override {
+        return expandSweepList(valueToExpand, outValues);
+    }
+
   protected:
     std::string toStringValue() const override {
         const auto valuesCount = sizeof(DerivedType::enumValues) / sizeof(DerivedType::enumValues[0]);
@@ -21,6 +21,52 @@ struct IntegerArgumentBase : Argument {
         return &value;
     }
 
+    // Besides lists, accepts ranges in form of first:last:step, where step is either added, e.g. 0:256:+32 or 0:256:32,
+    // or multiplied, e.g. 4KB:1GB:*2. Range bounds and added steps are parsed like regular values, so they may use units.
+    bool expandSweep(const std::string &valueToExpand, std::vector<std::string> &outValues) override {
+        std::vector<std::string> items{};
+        if (!expandSweepList(valueToExpand, items)) {
+            return false;
+        }
+
+        const auto savedValue = this->value;
+        outValues.clear();
+        for (const auto &item : items) {
+            const auto range = splitString(item, ':');
+            if (range.size() == 1) {
+                outValues.push_back(item);
+                continue;
+            }
+            if (range.size() != 3 || range[2].empty()) {
+                this->value = savedValue;
+                return false;
+            }
+
+            const bool multiply = range[2][0] == '*';
+            const bool hasStepSign = multiply || range[2][0] == '+';
+            parseImpl(range[0]);
+            const int64_t first = this->value;
+            parseImpl(range[1]);
+            const int64_t last = this->value;
+            parseImpl(range[2].substr(hasStepSign ? 1 : 0));
+            const int64_t step = this->value;
+            if (multiply ? (step < 2 || first < 1) : step < 1) {
+                this->value = savedValue;
+                return false;
+            }
+
+            for (int64_t current = first; current <= last;) {
+                outValues.push_back(std::to_string(current));
+                if (multiply ? current > last / step : current > last - step) {
+                    break;
+                }
+                current = multiply ? current * step : current + step;
+            }
+        }
+        this->value = savedValue;
+        return !outValues.empty();
+    }
+
   protected:
     std::string toStringValue() const override {
         return std::to_string(this->value);
@@ -108,6 +154,63 @@ struct NonNegativeIntegerArgument : IntegerArgumentBase {
     }
 };
 
+// Duration in seconds, accepts h, m and s units, e.g. 30m or 1h30m
+struct DurationArgument : NonNegativeIntegerArgument {
+    using NonNegativeIntegerArgument::NonNegativeIntegerArgument;
+
+    DurationArgument &operator=(size_t newValue) {
+        this->value = newValue;
+        markAsParsed();
+        return *this;
+    }
+
+    std::string toStringValue() const override {
+        if (this->value == 0) {
+            return "0";
+        }
+
+        std::string result{};
+        const int64_t hours = this->value / 3600;
+        const int64_t minutes = this->value / 60 % 60;
+        const int64_t seconds = this->value % 60;
+        if (hours > 0) {
+            result += std::to_string(hours) + "h";
+        }
+        if (minutes > 0) {
+            result += std::to_string(minutes) + "m";
+        }
+        if (seconds > 0) {
+            result += std::to_string(seconds) + "s";
+        }
+        return result;
+    }
+
+    void parseImpl(const std::string &valueToParse) override {
+        // Value without a unit is in seconds, invalid values are parsed as -1 and rejected by validate()
+        this->value = 0;
+        int64_t number = -1;
+        for (const char character : toLower(valueToParse)) {
+            if (character >= '0' && character <= '9') {
+                number = (number < 0 ? 0 : number * 10) + (character - '0');
+                continue;
+            }
+
+            const int64_t unitMultiplier = character == 'h' ? 3600 : character == 'm' ? 60 : character == 's' ? 1 : 0;
+            if (unitMultiplier == 0 || number < 0) {
+                this->value = -1;
+                return;
+            }
+            this->value += number * unitMultiplier;
+            number = -1;
+        }
+        if (number >= 0) {
+            this->value += number;
+        } else if (valueToParse.empty()) {
+            this->value = -1;
+        }
+    }
+};
+
 struct ByteSizeArgument : PositiveIntegerArgument {
     using PositiveIntegerArgument::PositiveIntegerArgument;
 
@@ -184,6 +287,10 @@ struct BooleanArgument : Argument {
         return value == 0 || value == 1;
     }
 
+    bool expandSweep(const std::string &valueToExpand, std::vector<std::string> &outValues) override {
+        return expandSweepList(valueToExpand, outValues);
+    }
+
   protected:
     std::string toStringValue() const override {
         return std::to_string(this->value);
@@ -0,0 +1,25 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/argument/abstract/enum_argument.h"
+#include "framework/enum/wait_strategy.h"
+
+struct WaitStrategyArgument : EnumArgument<WaitStrategyArgument, WaitStrategy> {
+    using EnumArgument::EnumArgument;
+    ThisType &operator=(EnumType newValue) {
+        this->value = newValue;
+        markAsParsed();
+        return *this;
+    }
+
+    const static inline std::string enumName = "wait strategy";
+    const static inline EnumType invalidEnumValue = EnumType::Unknown;
+    const static inline EnumType enumValues[6] = {EnumType::Spin, EnumType::SpinPause, EnumType::Umwait, EnumType::Tpause, EnumType::Backoff, EnumType::FutexSleep};
+    const static inline std::string enumValuesNames[6] = {"spin", "spinPause", "umwait", "tpause", "backoff", "futexSleep"};
+};
@@ -0,0 +1,27 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/argument/string_list_argument.h"
+
+// List of values, each passed with a separate occurrence of the argument, e.g. --plugin=a.so --plugin=b.so. Values are
+// taken as they are, so they can contain whitespace, unlike in StringListArgument. Keys of such arguments have to be
+// passed to CommandLineArgument::parseArguments() as repeatable.
+struct RepeatedStringArgument : StringListArgument {
+    using StringListArgument::StringListArgument;
+
+    RepeatedStringArgument &operator=(const std::vector<std::string> &newValue) {
+        StringListArgument::operator=(newValue);
+        return *this;
+    }
+
+  protected:
+    void parseImpl(const std::string &valueToParse) override {
+        this->value.push_back(valueToParse);
+    }
+};
@@ -44,3 +44,11 @@ std::string BenchmarkInfo::getBenchmarkDescription() const {
 int BenchmarkInfo::getTestCaseNameColumnWidth() const {
     return testCaseColumnWidth;
 }
+
+std::string BenchmarkInfo::getBenchmarkVersion() const {
+    return version;
+}
+
+void BenchmarkInfo::setBenchmarkVersion(const std::string &version) {
+    this->version = version;
+}
@@ -30,10 +30,13 @@ class BenchmarkInfo {
     std::string getBenchmarkFilename() const;
     std::string getBenchmarkDescription() const;
     int getTestCaseNameColumnWidth() const;
+    std::string getBenchmarkVersion() const;
+    void setBenchmarkVersion(const std::string &version);
 
   private:
     static std::unique_ptr<BenchmarkInfo> instance;
     std::string name;
     std::string description;
     int testCaseColumnWidth;
+    std::string version;
 };
@@ -11,11 +11,25 @@
 #include "framework/configuration.h"
 #include "framework/gtest_event_listener.h"
 #include "framework/print_device_info.h"
+#include "framework/progress_reporter.h"
+#include "framework/test_case/ab_comparison.h"
+#include "framework/test_case/api_comparison_report.h"
+#include "framework/test_case/autotuner.h"
+#include "framework/test_case/checkpoint.h"
+#include "framework/test_case/configuration_durations.h"
+#include "framework/test_case/execution_order.h"
+#include "framework/test_case/isolated_test_runner.h"
+#include "framework/test_case/run_to_run_variance.h"
+#include "framework/test_case/test_case_statistics.h"
+#include "framework/test_case/test_plan.h"
+#include "framework/test_case/time_budget.h"
 #include "framework/test_map.h"
 #include "framework/utility/common_help_message.h"
+#include "framework/utility/instrumentation_plugins.h"
 #include "framework/utility/string_utils.h"
 #include "framework/utility/working_directory_helper.h"
 
+#include <algorithm>
 #include <gtest/gtest.h>
 #include <iostream>
 
@@ -92,7 +106,9 @@ int BenchmarkMain::generateDocs() {
 BenchmarkMain::BenchmarkMain(int argc, char **argv, const std::string benchmarkVersion)
     : argc(argc),
       argv(argv),
-      benchmarkVersion(benchmarkVersion) {}
+      benchmarkVersion(benchmarkVersion) {
+    BenchmarkInfo::get().setBenchmarkVersion(benchmarkVersion);
+}
 
 int BenchmarkMain::executeSingleTest(const std::string &testName) {
     const auto &testMap = TestMap::get();
@@ -104,10 +120,13 @@ int BenchmarkMain::executeSingleTest(const std::string &testName) {
 
     TestCaseInterface *testCase = it->second.get();
     replaceGtestListener<SingleTestGtestListener>();
-    if (!testCase->runFromCommandLine(commandLineArguments)) {
+    if (!testCase->runFromCommandLine(commandLineArguments, true)) {
         std::cerr << "Error parsing command line\n";
         return 1;
     }
+    if (IsolatedTestRunner::isChildProcess()) {
+        return IsolatedTestRunner::getChildExitCode();
+    }
     return 0;
 }
 
@@ -124,10 +143,201 @@ int BenchmarkMain::executeAllTests() {
         return 1;
     }
 
+    if (ExecutionOrder::isShuffleEnabled()) {
+        ::testing::GTEST_FLAG(shuffle) = true;
+        ::testing::GTEST_FLAG(random_seed) = static_cast<int>(ExecutionOrder::getSeed() % 99999) + 1;
+    }
+
+    // Configurations are scheduled, run in rounds or counted for progress outside of googletest, which only lists them
+    if (TimeBudget::isEnabled() || ExecutionOrder::isRoundRobinEnabled() || Configuration::get().progress) {
+        std::vector<TestPlan::Entry> entries{};
+        if (const int result = collectAllTests(entries); result != 0) {
+            return result;
+        }
+        return TimeBudget::isEnabled() ? executeWithinTimeBudget(entries) : executePlanEntries(entries);
+    }
+
     replaceGtestListener<AllTestsGtestListener>();
     return RUN_ALL_TESTS();
 }
 
+int BenchmarkMain::executePlan(const std::string &planFile) {
+    if (const auto unprocessedArgs = CommandLineArgument::getUnprocessedArguments(commandLineArguments); !unprocessedArgs.empty()) {
+        const auto getKey = +[](const CommandLineArgument *a) { return a->getKey(); };
+        std::cerr << CommonHelpMessage::errorIgnoredCommandLineArgs() << joinStrings(", ", unprocessedArgs, getKey) << std::endl;
+        return 1;
+    }
+
+    std::vector<TestPlan::Entry> entries{};
+    if (std::string error{}; !TestPlan::load(planFile, entries, error)) {
+        std::cerr << error << std::endl;
+        return 1;
+    }
+
+    replaceGtestListener<SingleTestGtestListener>();
+    if (TimeBudget::isEnabled()) {
+        // Invalid lines are reported, but configurations of the other ones are still run
+        std::vector<TestPlan::Entry> configurations{};
+        const int collectResult = collectPlanEntries(entries, configurations);
+        const int result = executeWithinTimeBudget(configurations);
+        return collectResult != 0 ? collectResult : result;
+    }
+    return executePlanEntries(std::move(entries));
+}
+
+int BenchmarkMain::executePlanEntries(std::vector<TestPlan::Entry> entries) {
+    if (!Configuration::get().noColumnNames) {
+        TestCaseStatistics::printStatisticsHeader(Configuration::get().printType);
+    }
+    std::unique_ptr<ProgressReporter> progressReporter{};
+    if (Configuration::get().progress) {
+        const size_t iterationsPerRound = ExecutionOrder::isRoundRobinEnabled() ? static_cast<size_t>(Configuration::get().roundRobin) : static_cast<size_t>(Configuration::get().iterations);
+        progressReporter = std::make_unique<ProgressReporter>(entries, ExecutionOrder::getRoundsCount(), iterationsPerRound);
+    }
+    int result = 0;
+    std::vector<size_t> invalidLines{};
+    for (size_t round = 0; round < ExecutionOrder::getRoundsCount(); round++) {
+        ExecutionOrder::beginRound(round);
+        if (ExecutionOrder::isShuffleEnabled()) {
+            ExecutionOrder::shuffle(entries, round);
+        }
+        for (const auto &entry : entries) {
+            if (progressReporter) {
+                progressReporter->configurationStarted();
+            }
+            const bool isInvalid = std::find(invalidLines.begin(), invalidLines.end(), entry.lineNumber) != invalidLines.end();
+            if (!isInvalid && !executePlanEntry(entry.commandLine)) {
+                std::cerr << "Error in test plan line " << entry.lineNumber << ": " << entry.commandLine << std::endl;
+                invalidLines.push_back(entry.lineNumber);
+                result = 1;
+            }
+            if (progressReporter) {
+                progressReporter->configurationFinished(entry.commandLine);
+            }
+        }
+    }
+    return result;
+}
+
+bool BenchmarkMain::executePlanEntry(const std::string &commandLine) {
+    // Parse the line the same way as the command line of the benchmark
+    const std::vector<std::string> tokens = splitString(commandLine);
+    std::vector<char *> lineArgv = {argv[0]};
+    for (const auto &token : tokens) {
+        lineArgv.push_back(const_cast<char *>(token.c_str()));
+    }
+    CommandLineArguments lineArguments{};
+    if (std::string errors{}; !CommandLineArgument::parseArguments(static_cast<int>(lineArgv.size()), lineArgv.data(), lineArguments, errors)) {
+        std::cerr << errors << std::endl;
+        return false;
+    }
+
+    // --test and --api are handled here, remaining arguments belong to the test. Api of the line overrides the global
+    // one for this line only and lines for a different api than the one selected globally are skipped.
+    Configuration &configuration = Configuration::get();
+    const Api globalApi = configuration.selectedApi;
+    std::string testName{};
+    for (auto &lineArgument : lineArguments) {
+        if (lineArgument.isKeyEqualTo("test")) {
+            lineArgument.markAsProcessed();
+            testName = lineArgument.getValue();
+        }
+        configuration.selectedApi.parse(lineArgument);
+    }
+    const Api lineApi = configuration.selectedApi;
+    const bool lineApiValid = configuration.selectedApi.validate();
+    configuration.selectedApi = globalApi;
+    if (!lineApiValid) {
+        std::cerr << "Invalid api\n";
+        return false;
+    }
+    if (globalApi != Api::All && lineApi != globalApi) {
+        return true;
+    }
+
+    const auto &testMap = TestMap::get();
+    auto it = testMap.find(testName);
+    if (it == testMap.end()) {
+        std::cerr << "Unknown test case\n";
+        return false;
+    }
+
+    configuration.selectedApi = lineApi;
+    const bool result = it->second->runFromCommandLine(lineArguments, false);
+    configuration.selectedApi = globalApi;
+    return result;
+}
+
+int BenchmarkMain::collectAllTests(std::vector<TestPlan::Entry> &entries) {
+    // Tests are nooped, so they only export their configurations
+    Configuration &configuration = Configuration::get();
+    const Configuration::PrintType printType = configuration.printType;
+    configuration.noop = true;
+    configuration.printType = Configuration::PrintType::Noop;
+    TestPlan::beginCollecting(entries);
+    replaceGtestListener<SingleTestGtestListener>();
+    const int result = RUN_ALL_TESTS();
+    TestPlan::endCollecting();
+    configuration.noop = false;
+    configuration.printType = printType;
+    return result;
+}
+
+int BenchmarkMain::collectPlanEntries(const std::vector<TestPlan::Entry> &entries, std::vector<TestPlan::Entry> &configurations) {
+    // Entries are nooped, so they only export their configurations with names, one for each point of swept arguments
+    Configuration &configuration = Configuration::get();
+    const Configuration::PrintType printType = configuration.printType;
+    configuration.noop = true;
+    configuration.printType = Configuration::PrintType::Noop;
+    TestPlan::beginCollecting(configurations);
+    int result = 0;
+    for (const auto &entry : entries) {
+        if (!executePlanEntry(entry.commandLine)) {
+            std::cerr << "Error in test plan line " << entry.lineNumber << ": " << entry.commandLine << std::endl;
+            result = 1;
+        }
+    }
+    TestPlan::endCollecting();
+    configuration.noop = false;
+    configuration.printType = printType;
+    return result;
+}
+
+int BenchmarkMain::executeWithinTimeBudget(std::vector<TestPlan::Entry> entries) {
+    // Configurations of the same priority are run in the order of the plan, which may be shuffled
+    if (ExecutionOrder::isShuffleEnabled()) {
+        ExecutionOrder::shuffle(entries, 0);
+    }
+    TimeBudget timeBudget{entries};
+    if (std::string error{}; !timeBudget.load(error)) {
+        std::cerr << error << std::endl;
+        return 1;
+    }
+    timeBudget.schedule();
+
+    Configuration &configuration = Configuration::get();
+    if (!configuration.noColumnNames) {
+        TestCaseStatistics::printStatisticsHeader(configuration.printType);
+    }
+    const size_t iterations = configuration.iterations;
+    int result = 0;
+    for (size_t position = 0; position < timeBudget.getScheduledCount(); position++) {
+        const size_t budgetedIterations = timeBudget.beginConfiguration(position);
+        if (budgetedIterations == 0) {
+            continue;
+        }
+        configuration.iterations = budgetedIterations;
+        if (const auto &entry = timeBudget.getEntry(position); !executePlanEntry(entry.commandLine)) {
+            std::cerr << "Error in test configuration: " << entry.commandLine << std::endl;
+            result = 1;
+        }
+        timeBudget.endConfiguration(position);
+    }
+    configuration.iterations = iterations;
+    timeBudget.print();
+    return result;
+}
+
 void BenchmarkMain::printHelp() {
     const auto filename = BenchmarkInfo::get().getBenchmarkFilename();
     // clang-format off
@@ -142,7 +352,8 @@ void BenchmarkMain::printHelp() {
                  "\n"
                  "Second mode runs one specific benchmark with custom parameter values. Running benchmarks in this fashion requires "
                  "using --test argument, along with benchmark-specific parameters. All parameters have to be specified, there are no "
-                 "default values.\n"
+                 "default values. Numeric, boolean and enum parameters can also be swept - given a list, e.g. --wgs=32,64,256, or "
+                 "a range, e.g. --size=4KB:1GB:*2 or --count=0:64:+8, the test is run for all combinations of swept values in one process.\n"
                  "\n"
                  "Example invocations:\n"
                  "\t" << filename << "                                                runs all possible tests\n"
@@ -151,6 +362,16 @@ void BenchmarkMain::printHelp() {
                  "\t" << filename << " --gtest_filter=<regex>                         runs all tests matching a regular expression\n"
                  "\t" << filename << " --gtest_filter=*TestName*                      runs a test named \"TestName\" in all predefined configurations\n"
                  "\t" << filename << " --test=TestName --someParam=1 --otherParam=30  runs a test named \"TestName\" with specified parameters\n"
+                 "\t" << filename << " --test=TestName --someParam=1:64:*2            runs a test named \"TestName\" for someParam equal to 1, 2, 4, ..., 64\n"
+                 "\t" << filename << " --exportPlan=plan.txt --gtest_filter=*Copy*    writes command lines of all matching test configurations to plan.txt\n"
+                 "\t" << filename << " --runPlan=plan.txt                             runs all test configurations listed in plan.txt in one process\n"
+                 "\t" << filename << " --isolate --testTimeout=60                     runs each test configuration in a child process killed after 60 seconds\n"
+                 "\t" << filename << " --checkpoint=run.journal                       runs all tests, skipping the ones completed by a previous run with the same journal\n"
+                 "\t" << filename << " --abEnvB=LD_LIBRARY_PATH=/new_driver           compares driver from /new_driver with the default one, running both in alternation\n"
+                 "\t" << filename << " --test=TestName --repeatProcess=10             runs a test in 10 processes and reports variance of results between them\n"
+                 "\t" << filename << " --timeBudget=30m --history=results.txt         runs all tests within 30 minutes, giving more iterations to noisy and changed results\n"
+                 "\t" << filename << " --shuffle --roundRobin=2 --iterations=20       runs all tests in random order, in 10 rounds of 2 iterations each\n"
+                 "\t" << filename << " --test=TestName --wgs=64 --wgc=64 --autotune   searches for the workgroup size and count with the best result of a test\n"
                  "\n"
                 "All available test cases with their parameters:\n";
     // clang-format on
@@ -176,12 +397,14 @@ void BenchmarkMain::printHelp() {
 }
 
 int BenchmarkMain::setupEnvironment() {
-    // Kernels will be loaded from the CWD, so we need to ensure we're in the right directory.
+    // Kernels will be loaded from the CWD, so we need to ensure we're in the right directory. Paths passed by the user
+    // are relative to the original CWD, so they are made absolute before leaving it.
+    makePathArgumentsAbsolute();
     WorkingDirectoryHelper::changeDirectoryToExeDirectory();
 
     // Each command line argument must be parsed and validated.
     std::string commandLineArgumentsParsingErrors = {};
-    if (!CommandLineArgument::parseArguments(argc, argv, commandLineArguments, commandLineArgumentsParsingErrors)) {
+    if (!CommandLineArgument::parseArguments(argc, argv, commandLineArguments, commandLineArgumentsParsingErrors, Configuration::getRepeatableKeys())) {
         std::cerr << commandLineArgumentsParsingErrors << std::endl;
         return 1;
     }
@@ -196,6 +419,27 @@ int BenchmarkMain::setupEnvironment() {
     return 0;
 }
 
+void BenchmarkMain::makePathArgumentsAbsolute() {
+    // All later users of the command line, including child processes and plan entries, see the rewritten arguments
+    const FileSystem::path initialDirectory = FileSystem::current_path();
+    const auto &pathKeys = Configuration::getPathKeys();
+    absolutePathArguments.push_back(argv[0]);
+    for (int argIndex = 1; argIndex < argc; argIndex++) {
+        std::string argument = argv[argIndex];
+        const CommandLineArgument commandLineArgument{argv[argIndex]};
+        const bool isPath = commandLineArgument.isValid() && std::find(pathKeys.begin(), pathKeys.end(), commandLineArgument.getKey()) != pathKeys.end();
+        if (isPath && !commandLineArgument.getValue().empty() && FileSystem::path{commandLineArgument.getValue()}.is_relative()) {
+            argument = "--" + commandLineArgument.getKey() + "=" + (initialDirectory / commandLineArgument.getValue()).string();
+        }
+        absolutePathArguments.push_back(std::move(argument));
+    }
+    for (auto &argument : absolutePathArguments) {
+        absolutePathArgv.push_back(argument.data());
+    }
+    absolutePathArgv.push_back(nullptr);
+    argv = absolutePathArgv.data();
+}
+
 int BenchmarkMain::main() {
     // Perform general setup
     if (const int result = setupEnvironment(); result != 0) {
@@ -219,15 +463,55 @@ int BenchmarkMain::main() {
         return printVersion(true);
     }
 
+    // Load instrumentation plugins
+    if (std::string pluginErrors{}; !InstrumentationPlugins::load(configuration.plugin, pluginErrors)) {
+        std::cerr << pluginErrors;
+        return 1;
+    }
+
+    // Create the test plan file, configurations are appended to it as they are nooped
+    if (std::string planErrors{}; TestPlan::isExportEnabled() && !TestPlan::beginExport(planErrors)) {
+        std::cerr << planErrors << std::endl;
+        return 1;
+    }
+
+    // Load configurations completed by a previous, interrupted run
+    if (Checkpoint::isEnabled()) {
+        if (std::string checkpointErrors{}; !Checkpoint::load(checkpointErrors)) {
+            std::cerr << checkpointErrors << std::endl;
+            return 1;
+        }
+        if (const size_t completedCount = Checkpoint::get().getCompletedCount(); completedCount > 0) {
+            std::cerr << "Resuming from checkpoint, " << completedCount << " test configurations already completed\n";
+        }
+    }
+
+    // Remember arguments, which have to be passed to child processes running tests
+    IsolatedTestRunner::setCommandLine(argc, argv);
+
     // Run tests
     if (!Configuration::get().noHeaders) {
         DeviceInfo::printDeviceInfo();
         printVersion(false, "Benchmark version: ");
     }
+    if (ConfigurationDurations::isEnabled()) {
+        ConfigurationDurations::get().load();
+    }
+    int result = 0;
     if (std::string test = configuration.test; test != "") {
-        return executeSingleTest(test);
+        result = executeSingleTest(test);
+    } else if (std::string plan = configuration.runPlan; plan != "") {
+        result = executePlan(plan);
     } else {
         ::testing::InitGoogleTest(&argc, argv);
-        return executeAllTests();
+        result = executeAllTests();
+    }
+    if (ConfigurationDurations::isEnabled()) {
+        ConfigurationDurations::get().save();
     }
+    ApiComparisonReport::print();
+    AbComparison::print();
+    RunToRunVariance::print();
+    Autotuner::print();
+    return result;
 }
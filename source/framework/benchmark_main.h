@@ -7,9 +7,11 @@
 
 #pragma once
 
+#include "framework/test_case/test_plan.h"
 #include "framework/utility/command_line_argument.h"
 
 #include <string>
+#include <vector>
 
 class BenchmarkMain {
   public:
@@ -21,8 +23,11 @@ class BenchmarkMain {
     char **argv;
     const std::string benchmarkVersion;
     CommandLineArguments commandLineArguments = {};
+    std::vector<std::string> absolutePathArguments = {};
+    std::vector<char *> absolutePathArgv = {};
 
     int setupEnvironment();
+    void makePathArgumentsAbsolute();
 
     int printVersion(bool enableWarning, const char *prefix = "");
     void printHelp();
@@ -30,4 +35,10 @@ class BenchmarkMain {
 
     int executeSingleTest(const std::string &testName);
     int executeAllTests();
+    int executePlan(const std::string &planFile);
+    int executePlanEntries(std::vector<TestPlan::Entry> entries);
+    bool executePlanEntry(const std::string &commandLine);
+    int collectAllTests(std::vector<TestPlan::Entry> &entries);
+    int collectPlanEntries(const std::vector<TestPlan::Entry> &entries, std::vector<TestPlan::Entry> &configurations);
+    int executeWithinTimeBudget(std::vector<TestPlan::Entry> entries);
 };
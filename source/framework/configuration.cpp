@@ -9,6 +9,8 @@
 
 #include "framework/benchmark_info.h"
 
+#include <iostream>
+
 std::unique_ptr<Configuration> Configuration::instance = {};
 
 Configuration::Configuration()
@@ -38,7 +40,37 @@ Configuration::Configuration()
       argFilter(*this, "argFilter", "filter tests by their arguments"),
       testFilter(*this, "testFilter", "filter tests by their names"),
       returnSubmissionTimeInsteadOfWorkloadTime(*this, "forceSubmissionProfiling", "Overrides profiling to return submission time instead of workload time"),
-      markTimers(*this, "markTimers", "Provides prints around Timer Start & End") {
+      markTimers(*this, "markTimers", "Provides prints around Timer Start & End"),
+      waitStrategy(*this, "waitStrategy", "Method of waiting on host memory written by the device or other threads"),
+      trace(*this, "trace", "Write Chrome trace-event JSON with spans of test phases, timed iterations and child processes to a given file"),
+      energy(*this, "energy", "Report CPU package and DRAM energy per iteration measured with RAPL counters (Linux only)"),
+      plugin(*this, "plugin", "Load an instrumentation plugin from a given shared library. Pass the argument once for each plugin, e.g. --plugin=a.so --plugin=b.so. See framework/utility/instrumentation_plugin_interface.h"),
+      dumpSamples(*this, "dumpSamples", "Write all samples of each test configuration with their timestamps to binary files in a given directory. Use sample_dump_reader to analyze them"),
+      compareApis(*this, "compareApis", "After running all tests print results of configurations implemented in multiple APIs side by side, with ratios and differences beyond noise flagged"),
+      history(*this, "history", "Append results to a given history file, which can be queried for trends and change points with result_history"),
+      progress(*this, "progress", "In all-tests and test plan modes print completed and total number of test configurations, elapsed time and estimated time left to stderr after each configuration"),
+      durationCache(*this, "durationCache", "File storing durations of test configurations used by --progress to estimate time left and by --timeBudget to split iterations. Defaults to <benchmark name>_durations.txt next to the benchmark"),
+      reuseContexts(*this, "reuseContexts", "Reuse driver, devices, contexts and queues between tests instead of creating them in every test. Tests requiring a pristine context still create their own"),
+      exportPlan(*this, "exportPlan", "Instead of running tests, write command lines of all test configurations matching current filters to a file, which can be passed to --runPlan. Implies --noop"),
+      runPlan(*this, "runPlan", "Run test configurations from a file with one single-test mode command line per line, e.g. written by --exportPlan, in one process"),
+      isolate(*this, "isolate", "Run each test configuration in a separate child process, so a crash or a hang is reported as CRASH or TIMEOUT and remaining tests still run"),
+      testTimeout(*this, "testTimeout", "Time in seconds after which a test configuration run with --isolate is killed and reported as TIMEOUT. 0 disables the timeout"),
+      exitWithTestResult(*this, "exitWithTestResult", "Return result of the test as exit code and print only results of successful runs. Used internally by --isolate"),
+      checkpoint(*this, "checkpoint", "Append each completed test configuration with its output to a journal file. When restarted with the same file and arguments, completed configurations are skipped and their output is printed from the journal"),
+      abEnvA(*this, "abEnvA", "Environment variable selecting build A of the driver for an interleaved A/B comparison, e.g. LD_LIBRARY_PATH=/opt/a/lib. Pass the argument once for each variable. Compared with build selected by --abEnvB"),
+      abEnvB(*this, "abEnvB", "Environment variable selecting build B of the driver for an interleaved A/B comparison. Pass the argument once for each variable"),
+      abRounds(*this, "abRounds", "Number of rounds of an A/B comparison. In each round both builds run --iterations iterations of the test in fresh processes"),
+      repeatProcess(*this, "repeatProcess", "Run each test configuration in the given number of fresh processes and report how much results vary between processes compared to iterations within one process"),
+      timeBudget(*this, "timeBudget", "Run tests within a given time, e.g. 30m or 1h. Iterations are split between test configurations based on their durations in previous runs and deviations of results in --history, prioritizing unstable and changed results. Configurations which do not fit are skipped and reported"),
+      shuffle(*this, "shuffle", "Run test configurations in a random order, so results do not depend on state left by the same predecessor. The seed is printed to stderr"),
+      seed(*this, "seed", "Seed of the random order of --shuffle, e.g. printed by a previous run. 0 selects a random seed"),
+      roundRobin(*this, "roundRobin", "Run test configurations in rounds of a given number of iterations, interleaving iterations of all configurations. Results of each configuration are accumulated over all rounds. 0 disables rounds"),
+      autotune(*this, "autotune", "Search for the workgroup size and count of --test with the best result per work item, starting from the passed --wgs and --wgc. Only tests measuring work of the kernel can be autotuned. Sizes are limited by the device. Evaluated configurations and the best one are reported"),
+      autotuneEvaluations(*this, "autotuneEvaluations", "Maximum number of configurations evaluated by --autotune"),
+      synchronizationPipeIn(*this, "synchronizationPipeIn", "Handle of the synchronization pipe from the parent process. Used internally by A/B comparison, --repeatProcess and --isolate"),
+      synchronizationPipeOut(*this, "synchronizationPipeOut", "Handle of the synchronization pipe to the parent process. Used internally by A/B comparison, --repeatProcess and --isolate"),
+      measurementPipe(*this, "measurementPipe", "Handle of the pipe to which samples are written for the parent process. If 0, stdout is used. Used internally by A/B comparison, --repeatProcess and --isolate"),
+      samplesOnly(*this, "samplesOnly", "Pass samples to the parent process through --measurementPipe instead of printing results. Used internally by A/B comparison and --repeatProcess") {
 
     // Diagnostic params
     help = false;
@@ -73,6 +105,36 @@ Configuration::Configuration()
     argFilter = std::vector<std::string>();
     testFilter = std::vector<std::string>();
     returnSubmissionTimeInsteadOfWorkloadTime = false;
+    waitStrategy = WaitStrategy::Spin;
+    trace = "";
+    energy = false;
+    plugin = std::vector<std::string>();
+    dumpSamples = "";
+    compareApis = false;
+    history = "";
+    progress = false;
+    durationCache = "";
+    reuseContexts = false;
+    exportPlan = "";
+    runPlan = "";
+    isolate = false;
+    testTimeout = 600;
+    exitWithTestResult = false;
+    checkpoint = "";
+    abEnvA = std::vector<std::string>();
+    abEnvB = std::vector<std::string>();
+    abRounds = 6;
+    repeatProcess = 1;
+    timeBudget = 0;
+    shuffle = false;
+    seed = 0;
+    roundRobin = 0;
+    autotune = false;
+    autotuneEvaluations = 40;
+    synchronizationPipeIn = -1;
+    synchronizationPipeOut = -1;
+    measurementPipe = -1;
+    samplesOnly = false;
 }
 
 bool Configuration::parseArgumentsForConfiguration(CommandLineArguments &arguments) {
@@ -95,6 +157,9 @@ bool Configuration::parseArgumentsForConfiguration(CommandLineArguments &argumen
     if (configuration->verbose) {
         configuration->printType = Configuration::PrintType::DefaultWithVerbose;
     }
+    if (!static_cast<const std::string &>(configuration->exportPlan).empty()) {
+        configuration->noop = true;
+    }
     if (configuration->noop) {
         configuration->printType = Configuration::PrintType::Noop;
     }
@@ -112,9 +177,59 @@ Configuration &Configuration::get() {
     return *Configuration::instance;
 }
 
+// Keys of RepeatedStringArgument, which can be passed multiple times on the command line
+const std::vector<std::string> &Configuration::getRepeatableKeys() {
+    static const std::vector<std::string> keys = {"plugin", "abEnvA", "abEnvB"};
+    return keys;
+}
+
+// Keys of arguments naming files, which are given relative to the directory the benchmark is started in
+const std::vector<std::string> &Configuration::getPathKeys() {
+    static const std::vector<std::string> keys = {"trace", "plugin", "dumpSamples", "history", "durationCache", "exportPlan", "runPlan", "checkpoint"};
+    return keys;
+}
+
 bool Configuration::validateArgumentsExtra() const {
+    const bool hasTest = !static_cast<const std::string &>(test).empty();
+    const bool hasCheckpoint = !static_cast<const std::string &>(checkpoint).empty();
+    const bool hasAbComparison = !abEnvA.get().empty() || !abEnvB.get().empty();
     if (csv && verbose) {
+        std::cerr << "--csv cannot be used with --verbose\n";
+        return false;
+    }
+    if (hasTest && !static_cast<const std::string &>(runPlan).empty()) {
+        std::cerr << "--test cannot be used with --runPlan\n";
+        return false;
+    }
+    if (exitWithTestResult && !hasTest) {
+        std::cerr << "--exitWithTestResult requires --test\n";
+        return false;
+    }
+    if (samplesOnly && (!exitWithTestResult || measurementPipe < 0)) {
+        std::cerr << "--samplesOnly requires --exitWithTestResult and --measurementPipe\n";
+        return false;
+    }
+    if (timeBudget > 0 && hasTest) {
+        std::cerr << "--timeBudget cannot be used with --test\n";
         return false;
     }
+    if (roundRobin > 0) {
+        // Rounds accumulate statistics of all configurations in one process
+        if (isolate || repeatProcess > 1 || hasAbComparison || timeBudget > 0 || hasCheckpoint) {
+            std::cerr << "--roundRobin cannot be used with --isolate, --repeatProcess, --abEnvA, --abEnvB, --timeBudget or --checkpoint\n";
+            return false;
+        }
+    }
+    if (autotune) {
+        // The search runs configurations of a single test one after another in one process
+        if (!hasTest) {
+            std::cerr << "--autotune requires --test\n";
+            return false;
+        }
+        if (isolate || repeatProcess > 1 || hasAbComparison || roundRobin > 0 || hasCheckpoint) {
+            std::cerr << "--autotune cannot be used with --isolate, --repeatProcess, --abEnvA, --abEnvB, --roundRobin or --checkpoint\n";
+            return false;
+        }
+    }
     return true;
 }
@@ -12,6 +12,8 @@
 #include "framework/argument/boolean_flag_argument.h"
 #include "framework/argument/enum/api_argument.h"
 #include "framework/argument/enum/device_selection_argument.h"
+#include "framework/argument/enum/wait_strategy_argument.h"
+#include "framework/argument/repeated_string_argument.h"
 #include "framework/argument/string_argument.h"
 #include "framework/argument/string_list_argument.h"
 #include "framework/utility/command_line_argument.h"
@@ -35,6 +37,8 @@ struct Configuration : ArgumentContainer {
     static bool parseArgumentsForConfiguration(CommandLineArguments &arguments);
     static void loadDefaultConfiguration();
     static Configuration &get();
+    static const std::vector<std::string> &getRepeatableKeys();
+    static const std::vector<std::string> &getPathKeys();
 
     bool validateArgumentsExtra() const override;
 
@@ -72,6 +76,36 @@ struct Configuration : ArgumentContainer {
     StringListArgument testFilter;
     BooleanFlagArgument returnSubmissionTimeInsteadOfWorkloadTime;
     BooleanFlagArgument markTimers;
+    WaitStrategyArgument waitStrategy;
+    StringArgument trace;
+    BooleanFlagArgument energy;
+    RepeatedStringArgument plugin;
+    StringArgument dumpSamples;
+    BooleanFlagArgument compareApis;
+    StringArgument history;
+    BooleanFlagArgument progress;
+    StringArgument durationCache;
+    BooleanFlagArgument reuseContexts;
+    StringArgument exportPlan;
+    StringArgument runPlan;
+    BooleanFlagArgument isolate;
+    NonNegativeIntegerArgument testTimeout;
+    BooleanFlagArgument exitWithTestResult;
+    StringArgument checkpoint;
+    RepeatedStringArgument abEnvA;
+    RepeatedStringArgument abEnvB;
+    PositiveIntegerArgument abRounds;
+    PositiveIntegerArgument repeatProcess;
+    DurationArgument timeBudget;
+    BooleanFlagArgument shuffle;
+    NonNegativeIntegerArgument seed;
+    NonNegativeIntegerArgument roundRobin;
+    BooleanFlagArgument autotune;
+    PositiveIntegerArgument autotuneEvaluations;
+    IntegerArgument synchronizationPipeIn;
+    IntegerArgument synchronizationPipeOut;
+    IntegerArgument measurementPipe;
+    BooleanFlagArgument samplesOnly;
 };
 
 inline bool isNoopRun() {
@@ -17,6 +17,9 @@ enum class MeasurementUnit {
     Nanoseconds,
     GigabytesPerSecond,
     Latency,
+    Millijoules,
+    GigabytesPerSecondPerWatt,
+    Custom, // unit is a part of the description, e.g. for values contributed by plugins
 };
 
 namespace std {
@@ -30,6 +33,12 @@ inline std::string to_string(MeasurementUnit unit) {
         return "[GB/s]";
     case MeasurementUnit::Latency:
         return "[clk]";
+    case MeasurementUnit::Millijoules:
+        return "[mJ]";
+    case MeasurementUnit::GigabytesPerSecondPerWatt:
+        return "[GB/s/W]";
+    case MeasurementUnit::Custom:
+        return "";
     default:
         FATAL_ERROR("Unknown measurement unit");
     }
@@ -0,0 +1,19 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+enum class WaitStrategy {
+    Unknown,
+
+    Spin,       // empty loop, lowest latency, occupies the core and starves its hyperthread sibling
+    SpinPause,  // loop with pause instruction, friendlier to hyperthread sibling
+    Umwait,     // umonitor/umwait, core enters C0.1 until the monitored cache line is written
+    Tpause,     // short timed pauses in C0.1, no monitor
+    Backoff,    // exponentially growing pause sequences, yields the thread when waiting long
+    FutexSleep, // sleep in the kernel, woken by WaitHelper::notify or after a short timeout
+};
@@ -16,6 +16,7 @@ struct ContextProperties {
     bool requireCreationSuccess = true;
     bool createContext = true;
     bool fakeSubDeviceAllowed = false;
+    bool reuseFromSessionCache = true;
 
     static ContextProperties create() {
         return ContextProperties()
@@ -41,5 +42,11 @@ struct ContextProperties {
         requireCreationSuccess = false;
         return *this;
     }
+
+    // Do not take the context and queues from the session cache enabled with --reuseContexts
+    ContextProperties &requirePristineContext() {
+        reuseFromSessionCache = false;
+        return *this;
+    }
 };
 } // namespace L0
@@ -7,33 +7,30 @@
 
 #include "levelzero.h"
 
+#include "framework/l0/session_cache.h"
 #include "framework/l0/utility/queue_families_helper.h"
+#include "framework/utility/trace_recorder.h"
 
 namespace L0 {
 LevelZero::LevelZero(const QueueProperties &queueProperties, const ContextProperties &contextProperties,
                      const ExtensionProperties &extensionProperties)
     : driverIndex(Configuration::get().l0DriverIndex),
       rootDeviceIndex(Configuration::get().l0DeviceIndex) {
-    EXPECT_ZE_RESULT_SUCCESS(zeInit(ZE_INIT_FLAG_GPU_ONLY));
+    TraceScope traceScope{"LevelZero setup", "framework"};
+    const bool sessionCacheEnabled = SessionCache::isEnabled();
 
     // Get driver
-    uint32_t driverCount = 0;
-    EXPECT_ZE_RESULT_SUCCESS(zeDriverGet(&driverCount, nullptr));
-    if (driverIndex >= driverCount) {
-        FATAL_ERROR("Invalid LevelZero driver index. driverIndex=", driverIndex, " driverCount=", driverCount);
+    const auto drivers = sessionCacheEnabled ? SessionCache::get().getDrivers() : queryDrivers();
+    if (driverIndex >= drivers.size()) {
+        FATAL_ERROR("Invalid LevelZero driver index. driverIndex=", driverIndex, " driverCount=", drivers.size());
     }
-    auto drivers = std::make_unique<ze_driver_handle_t[]>(driverCount);
-    EXPECT_ZE_RESULT_SUCCESS(zeDriverGet(&driverCount, drivers.get()));
     this->driver = drivers[driverIndex];
 
     // Create root device
-    uint32_t deviceCount = 0;
-    EXPECT_ZE_RESULT_SUCCESS(zeDeviceGet(driver, &deviceCount, nullptr));
-    if (rootDeviceIndex >= deviceCount) {
-        FATAL_ERROR("Invalid LevelZero device index. deviceIndex=", rootDeviceIndex, " deviceCount=", deviceCount);
+    rootDevices = sessionCacheEnabled ? SessionCache::get().getRootDevices(driver) : queryRootDevices(driver);
+    if (rootDeviceIndex >= rootDevices.size()) {
+        FATAL_ERROR("Invalid LevelZero device index. deviceIndex=", rootDeviceIndex, " deviceCount=", rootDevices.size());
     }
-    rootDevices.resize(deviceCount);
-    EXPECT_ZE_RESULT_SUCCESS(zeDeviceGet(driver, &deviceCount, rootDevices.data()));
     this->rootDevice = rootDevices[rootDeviceIndex];
 
     // Create subDevices if needed
@@ -51,7 +48,12 @@ LevelZero::LevelZero(const QueueProperties &queueProperties, const ContextProper
     }
 
     // Create context on the default device
-    this->context = createContext(contextProperties);
+    if (sessionCacheEnabled && contextProperties.createContext && contextProperties.reuseFromSessionCache) {
+        this->context = SessionCache::get().acquireContext(driver);
+        this->contextFromSessionCache = this->context != nullptr;
+    } else {
+        this->context = createContext(contextProperties);
+    }
     if (this->context == nullptr) {
         return;
     }
@@ -67,6 +69,15 @@ LevelZero::LevelZero(const QueueProperties &queueProperties, const ContextProper
 }
 
 LevelZero::~LevelZero() {
+    TraceScope traceScope{"LevelZero teardown", "framework"};
+    if (contextFromSessionCache) {
+        for (auto &queue : commandQueues) {
+            SessionCache::get().releaseQueue(queue);
+        }
+        SessionCache::get().releaseContext(context);
+        return;
+    }
+
     for (auto &queue : commandQueues) {
         EXPECT_ZE_RESULT_SUCCESS(zeCommandQueueDestroy(queue));
     }
@@ -75,6 +86,24 @@ LevelZero::~LevelZero() {
     }
 }
 
+std::vector<ze_driver_handle_t> LevelZero::queryDrivers() {
+    EXPECT_ZE_RESULT_SUCCESS(zeInit(ZE_INIT_FLAG_GPU_ONLY));
+
+    uint32_t driverCount = 0;
+    EXPECT_ZE_RESULT_SUCCESS(zeDriverGet(&driverCount, nullptr));
+    std::vector<ze_driver_handle_t> drivers(driverCount);
+    EXPECT_ZE_RESULT_SUCCESS(zeDriverGet(&driverCount, drivers.data()));
+    return drivers;
+}
+
+std::vector<ze_device_handle_t> LevelZero::queryRootDevices(ze_driver_handle_t driver) {
+    uint32_t deviceCount = 0;
+    EXPECT_ZE_RESULT_SUCCESS(zeDeviceGet(driver, &deviceCount, nullptr));
+    std::vector<ze_device_handle_t> devices(deviceCount);
+    EXPECT_ZE_RESULT_SUCCESS(zeDeviceGet(driver, &deviceCount, devices.data()));
+    return devices;
+}
+
 ze_device_handle_t LevelZero::getDevice(DeviceSelection deviceSelection) const {
     FATAL_ERROR_IF(DeviceSelectionHelper::hasHost(deviceSelection), "Cannot get ze_device_handle_t for host");
     FATAL_ERROR_UNLESS(DeviceSelectionHelper::hasSingleDevice(deviceSelection), "Cannot get multiple devices");
@@ -135,7 +164,11 @@ QueueFamiliesHelper::QueueDesc LevelZero::createQueue(const QueueProperties &que
 
 ze_command_queue_handle_t LevelZero::createQueue(ze_device_handle_t deviceHandle, ze_command_queue_desc_t desc) {
     ze_command_queue_handle_t queue = {};
-    EXPECT_ZE_RESULT_SUCCESS(zeCommandQueueCreate(this->context, deviceHandle, &desc, &queue));
+    if (contextFromSessionCache) {
+        queue = SessionCache::get().acquireQueue(this->context, deviceHandle, desc);
+    } else {
+        EXPECT_ZE_RESULT_SUCCESS(zeCommandQueueCreate(this->context, deviceHandle, &desc, &queue));
+    }
     this->commandQueues.push_back(queue);
     return queue;
 }
@@ -68,6 +68,11 @@ struct LevelZero {
     // Returns device for given DeviceSelection. Getting multiple devices at once, e.g. Tile0|Tile1 is forbidden.
     ze_device_handle_t getDevice(DeviceSelection deviceSelection) const;
 
+    // Initialize LevelZero and enumerate drivers or root devices of a driver. Results are stored in the SessionCache, when
+    // it is enabled, so the queries are done only once per benchmark run.
+    static std::vector<ze_driver_handle_t> queryDrivers();
+    static std::vector<ze_device_handle_t> queryRootDevices(ze_driver_handle_t driver);
+
     // Utility methods for L0 getter functions
     ze_driver_ipc_properties_t getIpcProperties() const {
         ze_driver_ipc_properties_t ipcProperties{ZE_STRUCTURE_TYPE_DRIVER_IPC_PROPERTIES};
@@ -129,6 +134,7 @@ struct LevelZero {
     ze_device_handle_t rootDevice{};
     std::vector<ze_device_handle_t> subDevices{};
     std::vector<ze_command_queue_handle_t> commandQueues{};
+    bool contextFromSessionCache = false;
 };
 } // namespace L0
 
@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "session_cache.h"
+
+#include "framework/configuration.h"
+#include "framework/l0/levelzero.h"
+#include "framework/l0/utility/error.h"
+
+#include <limits>
+
+namespace L0 {
+
+bool SessionCache::isEnabled() {
+    return Configuration::get().reuseContexts;
+}
+
+SessionCache &SessionCache::get() {
+    static SessionCache sessionCache{};
+    return sessionCache;
+}
+
+SessionCache::~SessionCache() {
+    for (auto &[key, queues] : freeQueues) {
+        for (auto queue : queues) {
+            EXPECT_ZE_RESULT_SUCCESS(zeCommandQueueDestroy(queue));
+        }
+    }
+    for (auto &[driver, contexts] : freeContexts) {
+        for (auto context : contexts) {
+            EXPECT_ZE_RESULT_SUCCESS(zeContextDestroy(context));
+        }
+    }
+}
+
+const std::vector<ze_driver_handle_t> &SessionCache::getDrivers() {
+    std::lock_guard<std::mutex> lock{mutex};
+    if (!driversQueried) {
+        drivers = LevelZero::queryDrivers();
+        driversQueried = true;
+    }
+    return drivers;
+}
+
+const std::vector<ze_device_handle_t> &SessionCache::getRootDevices(ze_driver_handle_t driver) {
+    std::lock_guard<std::mutex> lock{mutex};
+    auto it = rootDevices.find(driver);
+    if (it == rootDevices.end()) {
+        it = rootDevices.emplace(driver, LevelZero::queryRootDevices(driver)).first;
+    }
+    return it->second;
+}
+
+ze_context_handle_t SessionCache::acquireContext(ze_driver_handle_t driver) {
+    std::lock_guard<std::mutex> lock{mutex};
+    ze_context_handle_t context{};
+    auto &contexts = freeContexts[driver];
+    if (contexts.empty()) {
+        const ze_context_desc_t contextDesc{ZE_STRUCTURE_TYPE_CONTEXT_DESC};
+        EXPECT_ZE_RESULT_SUCCESS(zeContextCreate(driver, &contextDesc, &context));
+        if (context == nullptr) {
+            return nullptr;
+        }
+    } else {
+        context = contexts.back();
+        contexts.pop_back();
+    }
+    acquiredContexts[context] = driver;
+    return context;
+}
+
+void SessionCache::releaseContext(ze_context_handle_t context) {
+    std::lock_guard<std::mutex> lock{mutex};
+    const auto it = acquiredContexts.find(context);
+    FATAL_ERROR_IF(it == acquiredContexts.end(), "Releasing context which was not acquired from the session cache");
+    const auto driver = it->second;
+    acquiredContexts.erase(it);
+
+    // A context which saw a device loss or other error cannot be trusted by the next test
+    if (zeContextGetStatus(context) != ZE_RESULT_SUCCESS) {
+        destroyFreeQueues(context);
+        EXPECT_ZE_RESULT_SUCCESS(zeContextDestroy(context));
+        return;
+    }
+    freeContexts[driver].push_back(context);
+}
+
+ze_command_queue_handle_t SessionCache::acquireQueue(ze_context_handle_t context, ze_device_handle_t device, const ze_command_queue_desc_t &desc) {
+    ze_command_queue_handle_t queue{};
+
+    // Extension structures cannot be compared, so such queues are never reused
+    if (desc.pNext != nullptr) {
+        EXPECT_ZE_RESULT_SUCCESS(zeCommandQueueCreate(context, device, &desc, &queue));
+        return queue;
+    }
+
+    std::lock_guard<std::mutex> lock{mutex};
+    const QueueKey key{context, device, desc.ordinal, desc.index, desc.flags, desc.mode, desc.priority};
+    auto &queues = freeQueues[key];
+    if (queues.empty()) {
+        EXPECT_ZE_RESULT_SUCCESS(zeCommandQueueCreate(context, device, &desc, &queue));
+        if (queue == nullptr) {
+            return nullptr;
+        }
+    } else {
+        queue = queues.back();
+        queues.pop_back();
+    }
+    acquiredQueues[queue] = key;
+    return queue;
+}
+
+void SessionCache::releaseQueue(ze_command_queue_handle_t queue) {
+    std::lock_guard<std::mutex> lock{mutex};
+    const auto it = acquiredQueues.find(queue);
+    if (it == acquiredQueues.end()) {
+        EXPECT_ZE_RESULT_SUCCESS(zeCommandQueueDestroy(queue));
+        return;
+    }
+    const auto key = it->second;
+    acquiredQueues.erase(it);
+
+    // Work left by the test must not leak into the next one
+    if (zeCommandQueueSynchronize(queue, std::numeric_limits<uint64_t>::max()) != ZE_RESULT_SUCCESS) {
+        EXPECT_ZE_RESULT_SUCCESS(zeCommandQueueDestroy(queue));
+        return;
+    }
+    freeQueues[key].push_back(queue);
+}
+
+void SessionCache::destroyFreeQueues(ze_context_handle_t context) {
+    for (auto it = freeQueues.begin(); it != freeQueues.end();) {
+        if (std::get<0>(it->first) != context) {
+            ++it;
+            continue;
+        }
+        for (auto queue : it->second) {
+            EXPECT_ZE_RESULT_SUCCESS(zeCommandQueueDestroy(queue));
+        }
+        it = freeQueues.erase(it);
+    }
+}
+
+} // namespace L0
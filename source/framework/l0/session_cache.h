@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <level_zero/ze_api.h>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+namespace L0 {
+
+// Pool of LevelZero objects shared between consecutive tests, enabled with --reuseContexts. Instead of paying for zeInit,
+// driver and device enumeration, context and queue creation in every test, LevelZero takes these objects from the cache
+// and returns them in its destructor. Contexts and queues are handed out exclusively, so two LevelZero objects alive at
+// the same time never share them. Returned queues are synchronized and returned contexts are checked for errors before
+// they can be handed out again, anything in a bad state is destroyed instead. Tests which need a pristine context opt
+// out with ContextProperties::requirePristineContext().
+class SessionCache {
+  public:
+    static bool isEnabled();
+    static SessionCache &get();
+    ~SessionCache();
+
+    const std::vector<ze_driver_handle_t> &getDrivers();
+    const std::vector<ze_device_handle_t> &getRootDevices(ze_driver_handle_t driver);
+
+    ze_context_handle_t acquireContext(ze_driver_handle_t driver);
+    void releaseContext(ze_context_handle_t context);
+
+    ze_command_queue_handle_t acquireQueue(ze_context_handle_t context, ze_device_handle_t device, const ze_command_queue_desc_t &desc);
+    void releaseQueue(ze_command_queue_handle_t queue);
+
+  private:
+    SessionCache() = default;
+
+    using QueueKey = std::tuple<ze_context_handle_t, ze_device_handle_t, uint32_t, uint32_t, ze_command_queue_flags_t, ze_command_queue_mode_t, ze_command_queue_priority_t>;
+    void destroyFreeQueues(ze_context_handle_t context);
+
+    std::mutex mutex{};
+    bool driversQueried = false;
+    std::vector<ze_driver_handle_t> drivers{};
+    std::map<ze_driver_handle_t, std::vector<ze_device_handle_t>> rootDevices{};
+    std::map<ze_driver_handle_t, std::vector<ze_context_handle_t>> freeContexts{};
+    std::map<ze_context_handle_t, ze_driver_handle_t> acquiredContexts{};
+    std::map<QueueKey, std::vector<ze_command_queue_handle_t>> freeQueues{};
+    std::map<ze_command_queue_handle_t, QueueKey> acquiredQueues{};
+};
+
+} // namespace L0
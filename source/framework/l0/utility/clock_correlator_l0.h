@@ -0,0 +1,25 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/l0/levelzero.h"
+#include "framework/utility/clock_correlator.h"
+
+namespace L0 {
+
+// Correlates global timestamps of a device with the host clock using zeDeviceGetGlobalTimestamps. Kernel timestamps
+// can be converted by passing getKernelTimestampValidBits as validBits to toHostNanoseconds.
+inline ClockCorrelator createClockCorrelator(LevelZero &levelzero, ze_device_handle_t device) {
+    ClockCorrelator correlator{levelzero.getTimestampValidBits(device), static_cast<double>(levelzero.getTimerResolution(device))};
+    correlator.setTimestampSource([device](ClockCorrelator::TimestampPair &pair) {
+        return zeDeviceGetGlobalTimestamps(device, &pair.hostNanoseconds, &pair.deviceTimestamp) == ZE_RESULT_SUCCESS;
+    });
+    return correlator;
+}
+
+} // namespace L0
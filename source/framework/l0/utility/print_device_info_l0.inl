@@ -96,4 +96,11 @@ static void printAvailableDevices() {
     std::cout << std::endl;
 }
 
+static size_t getMaxWorkgroupSize() {
+    ContextProperties contextProperties = ContextProperties::create().disable();
+    QueueProperties queueProperties = QueueProperties::create().disable();
+    LevelZero levelzero(queueProperties, contextProperties);
+    return levelzero.getDeviceComputeProperties().maxTotalGroupSize;
+}
+
 } // namespace L0
@@ -15,6 +15,7 @@ struct ContextProperties {
     DeviceSelection deviceSelection = DeviceSelection::Unknown;
     bool createContext = true;
     bool requireCreationSuccess = true;
+    bool reuseFromSessionCache = true;
 
     static ContextProperties create() {
         return ContextProperties()
@@ -35,5 +36,11 @@ struct ContextProperties {
         requireCreationSuccess = false;
         return *this;
     }
+
+    // Do not take the context and queues from the session cache enabled with --reuseContexts
+    ContextProperties &requirePristineContext() {
+        reuseFromSessionCache = false;
+        return *this;
+    }
 };
 } // namespace OCL
@@ -7,22 +7,26 @@
 
 #include "opencl.h"
 
+#include "framework/ocl/session_cache.h"
+#include "framework/utility/trace_recorder.h"
+
 namespace OCL {
 
 Opencl::Opencl(const QueueProperties &queueProperties, const ContextProperties &contextProperties) {
-    // Get Platform
-    cl_uint numPlatforms;
-    EXPECT_CL_SUCCESS(clGetPlatformIDs(0, nullptr, &numPlatforms));
+    TraceScope traceScope{"Opencl setup", "framework"};
+    const bool sessionCacheEnabled = SessionCache::isEnabled();
 
-    auto platforms = std::make_unique<cl_platform_id[]>(numPlatforms);
-    EXPECT_CL_SUCCESS(clGetPlatformIDs(numPlatforms, platforms.get(), nullptr));
+    // Get Platform
+    const auto platforms = sessionCacheEnabled ? SessionCache::get().getPlatforms() : queryPlatforms();
+    const auto numPlatforms = static_cast<cl_uint>(platforms.size());
+    const auto getGpuDevices = [sessionCacheEnabled](cl_platform_id platform) {
+        return sessionCacheEnabled ? SessionCache::get().getGpuDevices(platform) : queryGpuDevices(platform);
+    };
 
     auto platformIndex = Configuration::get().oclPlatformIndex;
-    cl_uint numDevices;
-
     if (platformIndex == -1) {
         for (uint32_t localPlatformIndex = 0u; localPlatformIndex < numPlatforms; localPlatformIndex++) {
-            if (clGetDeviceIDs(platforms[localPlatformIndex], CL_DEVICE_TYPE_GPU, 0, nullptr, &numDevices) == CL_SUCCESS) {
+            if (!getGpuDevices(platforms[localPlatformIndex]).empty()) {
                 platformIndex = localPlatformIndex;
             }
         }
@@ -35,13 +39,12 @@ Opencl::Opencl(const QueueProperties &queueProperties, const ContextProperties &
     this->platform = platforms[platformIndex];
 
     // Create root device
-    EXPECT_CL_SUCCESS(clGetDeviceIDs(platform, CL_DEVICE_TYPE_GPU, 0, nullptr, &numDevices));
+    const auto devices = getGpuDevices(platform);
+    const auto numDevices = static_cast<cl_uint>(devices.size());
     const auto deviceIndex = Configuration::get().oclDeviceIndex;
     if (deviceIndex >= numDevices) {
         FATAL_ERROR("Invalid OCL device index. deviceIndex=", deviceIndex, " numDevices=", numDevices);
     }
-    auto devices = std::make_unique<cl_device_id[]>(numDevices);
-    EXPECT_CL_SUCCESS(clGetDeviceIDs(platform, CL_DEVICE_TYPE_GPU, numDevices, devices.get(), nullptr));
     this->rootDevice = devices[deviceIndex];
 
     // Create sub devices if needed
@@ -59,7 +62,7 @@ Opencl::Opencl(const QueueProperties &queueProperties, const ContextProperties &
     }
 
     // Create context on the default device
-    this->context = createContext(contextProperties);
+    this->context = createContext(contextProperties, sessionCacheEnabled && contextProperties.reuseFromSessionCache);
     if (this->context == nullptr) {
         return;
     }
@@ -69,15 +72,43 @@ Opencl::Opencl(const QueueProperties &queueProperties, const ContextProperties &
 }
 
 Opencl::~Opencl() {
+    TraceScope traceScope{"Opencl teardown", "framework"};
     for (auto &queueToRelease : commandQueues) {
-        EXPECT_CL_SUCCESS(clReleaseCommandQueue(queueToRelease));
+        if (contextFromSessionCache) {
+            SessionCache::get().releaseQueue(queueToRelease);
+        } else {
+            EXPECT_CL_SUCCESS(clReleaseCommandQueue(queueToRelease));
+        }
+    }
+    if (contextFromSessionCache) {
+        SessionCache::get().releaseContext(context);
     }
     for (auto &contextToRelease : contexts) {
         EXPECT_CL_SUCCESS(clReleaseContext(contextToRelease));
     }
-    for (auto &subDeviceToRelease : subDevices) {
-        EXPECT_CL_SUCCESS(clReleaseDevice(subDeviceToRelease));
+    if (!SessionCache::isEnabled()) {
+        for (auto &subDeviceToRelease : subDevices) {
+            EXPECT_CL_SUCCESS(clReleaseDevice(subDeviceToRelease));
+        }
+    }
+}
+
+std::vector<cl_platform_id> Opencl::queryPlatforms() {
+    cl_uint numPlatforms{};
+    EXPECT_CL_SUCCESS(clGetPlatformIDs(0, nullptr, &numPlatforms));
+    std::vector<cl_platform_id> platforms(numPlatforms);
+    EXPECT_CL_SUCCESS(clGetPlatformIDs(numPlatforms, platforms.data(), nullptr));
+    return platforms;
+}
+
+std::vector<cl_device_id> Opencl::queryGpuDevices(cl_platform_id platform) {
+    cl_uint numDevices{};
+    if (clGetDeviceIDs(platform, CL_DEVICE_TYPE_GPU, 0, nullptr, &numDevices) != CL_SUCCESS) {
+        return {};
     }
+    std::vector<cl_device_id> devices(numDevices);
+    EXPECT_CL_SUCCESS(clGetDeviceIDs(platform, CL_DEVICE_TYPE_GPU, numDevices, devices.data(), nullptr));
+    return devices;
 }
 
 cl_command_queue Opencl::createQueue(QueueProperties queueProperties) {
@@ -92,7 +123,11 @@ cl_command_queue Opencl::createQueue(QueueProperties queueProperties) {
 
     // Create queue
     if (queueProperties.fillQueueProperties(deviceForQueue, properties, maxPropertiesCount)) {
-        queue = clCreateCommandQueueWithProperties(this->context, deviceForQueue, properties, &retVal);
+        if (contextFromSessionCache) {
+            queue = SessionCache::get().acquireQueue(this->context, deviceForQueue, properties, maxPropertiesCount, &retVal);
+        } else {
+            queue = clCreateCommandQueueWithProperties(this->context, deviceForQueue, properties, &retVal);
+        }
     }
 
     if (queueProperties.requireCreationSuccess) {
@@ -106,6 +141,10 @@ cl_command_queue Opencl::createQueue(QueueProperties queueProperties) {
 }
 
 cl_context Opencl::createContext(const ContextProperties &contextProperties) {
+    return createContext(contextProperties, false);
+}
+
+cl_context Opencl::createContext(const ContextProperties &contextProperties, bool useSessionCache) {
     if (!contextProperties.createContext) {
         return nullptr;
     }
@@ -117,12 +156,19 @@ cl_context Opencl::createContext(const ContextProperties &contextProperties) {
     }
 
     cl_int retVal{};
-    cl_context createdContext = clCreateContext(nullptr, static_cast<cl_uint>(devicesForContext.size()), devicesForContext.data(), nullptr, nullptr, &retVal);
+    cl_context createdContext{};
+    if (useSessionCache) {
+        createdContext = SessionCache::get().acquireContext(devicesForContext, &retVal);
+    } else {
+        createdContext = clCreateContext(nullptr, static_cast<cl_uint>(devicesForContext.size()), devicesForContext.data(), nullptr, nullptr, &retVal);
+    }
     if (contextProperties.requireCreationSuccess) {
         CL_SUCCESS_OR_ERROR(retVal, "Context creation failed");
     }
 
-    if (createdContext) {
+    if (createdContext && useSessionCache) {
+        this->contextFromSessionCache = true;
+    } else if (createdContext) {
         this->contexts.push_back(createdContext);
     }
     return createdContext;
@@ -181,6 +227,12 @@ bool Opencl::createSubDevices(bool requireSuccess) {
     if (subDevices.size() != 0) {
         return true;
     }
+    if (SessionCache::isEnabled()) {
+        this->subDevices = SessionCache::get().getSubDevices(this->rootDevice);
+        if (subDevices.size() != 0) {
+            return true;
+        }
+    }
 
     cl_device_affinity_domain domain{};
     EXPECT_CL_SUCCESS(clGetDeviceInfo(this->rootDevice, CL_DEVICE_PARTITION_AFFINITY_DOMAIN, sizeof(domain), &domain, NULL));
@@ -198,6 +250,9 @@ bool Opencl::createSubDevices(bool requireSuccess) {
     EXPECT_CL_SUCCESS(clCreateSubDevices(this->rootDevice, properties, 0, nullptr, &numSubDevices));
     this->subDevices.resize(numSubDevices);
     EXPECT_CL_SUCCESS(clCreateSubDevices(this->rootDevice, properties, numSubDevices, this->subDevices.data(), nullptr));
+    if (SessionCache::isEnabled()) {
+        SessionCache::get().addSubDevices(this->rootDevice, this->subDevices);
+    }
     return true;
 }
 
@@ -47,10 +47,16 @@ struct Opencl {
     // Get helper used to query if certain extensions are supported by the OpenCL implementation
     const ExtensionsHelper &getExtensions();
 
+    // Enumerate platforms or GPU devices of a platform. Results are stored in the SessionCache, when it is enabled,
+    // so the queries are done only once per benchmark run.
+    static std::vector<cl_platform_id> queryPlatforms();
+    static std::vector<cl_device_id> queryGpuDevices(cl_platform_id platform);
+
   private:
     // Queriers subDevices of the root device and creates them if any. This method is only called when
     // it's necessary, i.e. user specified some subDevices in ContextProperties.
     bool createSubDevices(bool requireSuccess);
+    cl_context createContext(const ContextProperties &contextProperties, bool useSessionCache);
 
     // Internal fields managed by the Opencl class
     cl_device_id rootDevice;
@@ -58,6 +64,7 @@ struct Opencl {
     std::vector<cl_context> contexts{};
     std::vector<cl_command_queue> commandQueues{};
     std::unique_ptr<ExtensionsHelper> extensionsHelper{};
+    bool contextFromSessionCache = false;
 };
 
 } // namespace OCL
@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "session_cache.h"
+
+#include "framework/configuration.h"
+#include "framework/ocl/opencl.h"
+#include "framework/ocl/utility/error.h"
+
+namespace OCL {
+
+bool SessionCache::isEnabled() {
+    return Configuration::get().reuseContexts;
+}
+
+SessionCache &SessionCache::get() {
+    static SessionCache sessionCache{};
+    return sessionCache;
+}
+
+SessionCache::~SessionCache() {
+    for (auto &[key, queues] : freeQueues) {
+        for (auto queue : queues) {
+            EXPECT_CL_SUCCESS(clReleaseCommandQueue(queue));
+        }
+    }
+    for (auto &[devices, contexts] : freeContexts) {
+        for (auto context : contexts) {
+            EXPECT_CL_SUCCESS(clReleaseContext(context));
+        }
+    }
+    for (auto &[rootDevice, devices] : subDevices) {
+        for (auto subDevice : devices) {
+            EXPECT_CL_SUCCESS(clReleaseDevice(subDevice));
+        }
+    }
+}
+
+const std::vector<cl_platform_id> &SessionCache::getPlatforms() {
+    std::lock_guard<std::mutex> lock{mutex};
+    if (!platformsQueried) {
+        platforms = Opencl::queryPlatforms();
+        platformsQueried = true;
+    }
+    return platforms;
+}
+
+const std::vector<cl_device_id> &SessionCache::getGpuDevices(cl_platform_id platform) {
+    std::lock_guard<std::mutex> lock{mutex};
+    auto it = gpuDevices.find(platform);
+    if (it == gpuDevices.end()) {
+        it = gpuDevices.emplace(platform, Opencl::queryGpuDevices(platform)).first;
+    }
+    return it->second;
+}
+
+const std::vector<cl_device_id> &SessionCache::getSubDevices(cl_device_id rootDevice) {
+    std::lock_guard<std::mutex> lock{mutex};
+    return subDevices[rootDevice];
+}
+
+void SessionCache::addSubDevices(cl_device_id rootDevice, const std::vector<cl_device_id> &newSubDevices) {
+    std::lock_guard<std::mutex> lock{mutex};
+    auto &devices = subDevices[rootDevice];
+    FATAL_ERROR_UNLESS(devices.empty(), "SubDevices are already cached for this device");
+    devices = newSubDevices;
+}
+
+cl_context SessionCache::acquireContext(const std::vector<cl_device_id> &devices, cl_int *retVal) {
+    std::lock_guard<std::mutex> lock{mutex};
+    cl_context context{};
+    auto &contexts = freeContexts[devices];
+    if (contexts.empty()) {
+        context = clCreateContext(nullptr, static_cast<cl_uint>(devices.size()), devices.data(), nullptr, nullptr, retVal);
+        if (context == nullptr) {
+            return nullptr;
+        }
+    } else {
+        context = contexts.back();
+        contexts.pop_back();
+        *retVal = CL_SUCCESS;
+    }
+    acquiredContexts[context] = devices;
+    return context;
+}
+
+void SessionCache::releaseContext(cl_context context) {
+    std::lock_guard<std::mutex> lock{mutex};
+    const auto it = acquiredContexts.find(context);
+    FATAL_ERROR_IF(it == acquiredContexts.end(), "Releasing context which was not acquired from the session cache");
+    freeContexts[it->second].push_back(context);
+    acquiredContexts.erase(it);
+}
+
+cl_command_queue SessionCache::acquireQueue(cl_context context, cl_device_id device, const cl_queue_properties properties[], size_t propertiesCount, cl_int *retVal) {
+    std::lock_guard<std::mutex> lock{mutex};
+    const QueueKey key{context, device, std::vector<cl_queue_properties>(properties, properties + propertiesCount)};
+    cl_command_queue queue{};
+    auto &queues = freeQueues[key];
+    if (queues.empty()) {
+        queue = clCreateCommandQueueWithProperties(context, device, properties, retVal);
+        if (queue == nullptr) {
+            return nullptr;
+        }
+    } else {
+        queue = queues.back();
+        queues.pop_back();
+        *retVal = CL_SUCCESS;
+    }
+    acquiredQueues[queue] = key;
+    return queue;
+}
+
+void SessionCache::releaseQueue(cl_command_queue queue) {
+    std::lock_guard<std::mutex> lock{mutex};
+    const auto it = acquiredQueues.find(queue);
+    FATAL_ERROR_IF(it == acquiredQueues.end(), "Releasing queue which was not acquired from the session cache");
+    const auto key = it->second;
+    acquiredQueues.erase(it);
+
+    // Work left by the test must not leak into the next one
+    if (clFinish(queue) != CL_SUCCESS) {
+        EXPECT_CL_SUCCESS(clReleaseCommandQueue(queue));
+        return;
+    }
+    freeQueues[key].push_back(queue);
+}
+
+} // namespace OCL
@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/ocl/cl.h"
+
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+namespace OCL {
+
+// Pool of OpenCL objects shared between consecutive tests, enabled with --reuseContexts. Instead of querying platforms,
+// creating subDevices, contexts and queues in every test, Opencl takes these objects from the cache and returns them in
+// its destructor. Contexts and queues are handed out exclusively, so two Opencl objects alive at the same time never
+// share them. Returned queues are finished before they can be handed out again and queues which fail to finish are
+// released. Tests which need a pristine context opt out with ContextProperties::requirePristineContext().
+class SessionCache {
+  public:
+    static bool isEnabled();
+    static SessionCache &get();
+    ~SessionCache();
+
+    const std::vector<cl_platform_id> &getPlatforms();
+    const std::vector<cl_device_id> &getGpuDevices(cl_platform_id platform);
+
+    // SubDevices passed to addSubDevices are owned by the cache from then on
+    const std::vector<cl_device_id> &getSubDevices(cl_device_id rootDevice);
+    void addSubDevices(cl_device_id rootDevice, const std::vector<cl_device_id> &subDevices);
+
+    cl_context acquireContext(const std::vector<cl_device_id> &devices, cl_int *retVal);
+    void releaseContext(cl_context context);
+
+    cl_command_queue acquireQueue(cl_context context, cl_device_id device, const cl_queue_properties properties[], size_t propertiesCount, cl_int *retVal);
+    void releaseQueue(cl_command_queue queue);
+
+  private:
+    SessionCache() = default;
+
+    using QueueKey = std::tuple<cl_context, cl_device_id, std::vector<cl_queue_properties>>;
+
+    std::mutex mutex{};
+    bool platformsQueried = false;
+    std::vector<cl_platform_id> platforms{};
+    std::map<cl_platform_id, std::vector<cl_device_id>> gpuDevices{};
+    std::map<cl_device_id, std::vector<cl_device_id>> subDevices{};
+    std::map<std::vector<cl_device_id>, std::vector<cl_context>> freeContexts{};
+    std::map<cl_context, std::vector<cl_device_id>> acquiredContexts{};
+    std::map<QueueKey, std::vector<cl_command_queue>> freeQueues{};
+    std::map<cl_command_queue, QueueKey> acquiredQueues{};
+};
+
+} // namespace OCL
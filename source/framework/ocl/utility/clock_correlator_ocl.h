@@ -0,0 +1,32 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/ocl/opencl.h"
+#include "framework/utility/clock_correlator.h"
+
+namespace OCL {
+
+// Correlates the device timer, which is also used for profiling events, with the host clock using
+// clGetDeviceAndHostTimer. Both timers are reported in nanoseconds by OpenCL.
+inline ClockCorrelator createClockCorrelator(cl_device_id device) {
+    ClockCorrelator correlator{64u, 1.0};
+    correlator.setTimestampSource([device](ClockCorrelator::TimestampPair &pair) {
+        cl_ulong deviceTimestamp{};
+        cl_ulong hostTimestamp{};
+        if (clGetDeviceAndHostTimer(device, &deviceTimestamp, &hostTimestamp) != CL_SUCCESS) {
+            return false;
+        }
+        pair.hostNanoseconds = hostTimestamp;
+        pair.deviceTimestamp = deviceTimestamp;
+        return true;
+    });
+    return correlator;
+}
+
+} // namespace OCL
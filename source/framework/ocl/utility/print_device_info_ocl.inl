@@ -93,4 +93,13 @@ static void printAvailableDevices() {
     std::cout << std::endl;
 }
 
+static size_t getMaxWorkgroupSize() {
+    ContextProperties contextProperties = ContextProperties::create().disable();
+    QueueProperties queueProperties = QueueProperties::create().disable();
+    Opencl opencl(queueProperties, contextProperties);
+    size_t maxWorkgroupSize = 0;
+    CL_SUCCESS_OR_ERROR(clGetDeviceInfo(opencl.device, CL_DEVICE_MAX_WORK_GROUP_SIZE, sizeof(maxWorkgroupSize), &maxWorkgroupSize, nullptr), "clGetDeviceInfo failed");
+    return maxWorkgroupSize;
+}
+
 } // namespace OCL
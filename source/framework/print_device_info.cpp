@@ -12,15 +12,18 @@
 
 DeviceInfo::Functions DeviceInfo::functions[static_cast<int>(Api::COUNT)] = {};
 
-void DeviceInfo::registerFunctions(Api api, PrintDeviceInfoFunction printDeviceInfo, PrintAvailableDevicesFunction printAvailableDevices) {
+void DeviceInfo::registerFunctions(Api api, PrintDeviceInfoFunction printDeviceInfo, PrintAvailableDevicesFunction printAvailableDevices,
+                                   GetMaxWorkgroupSizeFunction getMaxWorkgroupSize) {
     FATAL_ERROR_IF(printDeviceInfo == nullptr, "Cannot register null function");
     FATAL_ERROR_IF(printAvailableDevices == nullptr, "Cannot register null function");
+    FATAL_ERROR_IF(getMaxWorkgroupSize == nullptr, "Cannot register null function");
 
     auto &slot = functions[static_cast<int>(api)];
     FATAL_ERROR_IF(slot.printDeviceInfo != nullptr, "printDeviceInfo function registered multiple times");
     FATAL_ERROR_IF(slot.printAvailableDevices != nullptr, "printAvailableDevices function registered multiple times");
     slot.printDeviceInfo = printDeviceInfo;
     slot.printAvailableDevices = printAvailableDevices;
+    slot.getMaxWorkgroupSize = getMaxWorkgroupSize;
 }
 
 void DeviceInfo::printDeviceInfo() {
@@ -58,3 +61,11 @@ void DeviceInfo::printAvailableDevices() {
         printAvailableDevices();
     }
 }
+
+size_t DeviceInfo::getMaxWorkgroupSize(Api api) {
+    auto &getMaxWorkgroupSize = functions[static_cast<int>(api)].getMaxWorkgroupSize;
+    if (getMaxWorkgroupSize == nullptr) {
+        return 0;
+    }
+    return getMaxWorkgroupSize();
+}
@@ -9,18 +9,24 @@
 
 #include "framework/enum/api.h"
 
+#include <cstddef>
+
 struct DeviceInfo {
     using PrintDeviceInfoFunction = void (*)();
     using PrintAvailableDevicesFunction = void (*)();
-    static void registerFunctions(Api api, PrintDeviceInfoFunction printDeviceInfo, PrintAvailableDevicesFunction printAvailableDevices);
+    using GetMaxWorkgroupSizeFunction = size_t (*)();
+    static void registerFunctions(Api api, PrintDeviceInfoFunction printDeviceInfo, PrintAvailableDevicesFunction printAvailableDevices,
+                                  GetMaxWorkgroupSizeFunction getMaxWorkgroupSize);
 
     static void printDeviceInfo();
     static void printAvailableDevices();
+    static size_t getMaxWorkgroupSize(Api api); // 0 if unknown
 
   private:
     struct Functions {
         PrintDeviceInfoFunction printDeviceInfo = nullptr;
         PrintAvailableDevicesFunction printAvailableDevices = nullptr;
+        GetMaxWorkgroupSizeFunction getMaxWorkgroupSize = nullptr;
     };
     static Functions functions[static_cast<int>(Api::COUNT)];
 };
@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "progress_reporter.h"
+
+#include "framework/test_case/configuration_durations.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+ProgressReporter::ProgressReporter(const std::vector<TestPlan::Entry> &entries, size_t runsCount, size_t iterationsPerRun)
+    : totalCount(entries.size() * runsCount),
+      startTime(Clock::now()) {
+    for (const auto &entry : entries) {
+        if (const double secondsPerIteration = ConfigurationDurations::get().getSecondsPerIteration(entry.commandLine); secondsPerIteration >= 0) {
+            estimatedSeconds[entry.commandLine] = secondsPerIteration * static_cast<double>(iterationsPerRun);
+            remainingEstimatedSeconds += estimatedSeconds[entry.commandLine] * static_cast<double>(runsCount);
+        } else {
+            remainingUnknownCount += runsCount;
+        }
+    }
+}
+
+void ProgressReporter::configurationStarted() {
+    currentStartTime = Clock::now();
+}
+
+void ProgressReporter::configurationFinished(const std::string &commandLine) {
+    const Clock::time_point now = Clock::now();
+    completedSeconds += Seconds(now - currentStartTime).count();
+    completedCount++;
+
+    if (const auto it = estimatedSeconds.find(commandLine); it != estimatedSeconds.end()) {
+        remainingEstimatedSeconds = std::max(0.0, remainingEstimatedSeconds - it->second);
+    } else if (remainingUnknownCount > 0) {
+        remainingUnknownCount--;
+    }
+
+    const double averageSeconds = completedSeconds / static_cast<double>(completedCount);
+    const Seconds estimatedTimeLeft{remainingEstimatedSeconds + static_cast<double>(remainingUnknownCount) * averageSeconds};
+    std::cerr << "Progress: " << completedCount << "/" << totalCount << " test configurations, elapsed " << formatDuration(now - startTime)
+              << ", ETA " << formatDuration(estimatedTimeLeft) << std::endl;
+}
+
+std::string ProgressReporter::formatDuration(Seconds duration) {
+    const auto totalSeconds = static_cast<long long>(duration.count());
+    std::ostringstream result{};
+    result << totalSeconds / 3600 << ':' << std::setfill('0') << std::setw(2) << totalSeconds / 60 % 60 << ':' << std::setw(2) << totalSeconds % 60;
+    return result.str();
+}
@@ -0,0 +1,45 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/test_case/test_plan.h"
+
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+
+// Reports progress of a run of test configurations enabled with --progress. After each configuration it prints the
+// number of completed configurations, elapsed time and estimated time left to stderr. The estimate is based on durations
+// of the same configurations in previous runs from ConfigurationDurations, scaled to iterations of the current run.
+// Configurations without a known duration are assumed to take as long as an average configuration of the current run.
+class ProgressReporter {
+  public:
+    using Clock = std::chrono::steady_clock;
+    using Seconds = std::chrono::duration<double>;
+
+    // Each configuration is run the given number of times, e.g. once in each round of --roundRobin
+    ProgressReporter(const std::vector<TestPlan::Entry> &entries, size_t runsCount, size_t iterationsPerRun);
+
+    void configurationStarted();
+    void configurationFinished(const std::string &commandLine);
+
+    static std::string formatDuration(Seconds duration);
+
+  private:
+    const size_t totalCount;
+    const Clock::time_point startTime;
+    Clock::time_point currentStartTime = {};
+    std::map<std::string, double> estimatedSeconds = {}; // of a single run, only for configurations with known durations
+
+    // Remaining runs are split into ones with known durations, which are summed, and the rest
+    size_t completedCount = 0;
+    double remainingEstimatedSeconds = 0;
+    size_t remainingUnknownCount = 0;
+    double completedSeconds = 0;
+};
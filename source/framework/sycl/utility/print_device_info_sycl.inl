@@ -88,4 +88,8 @@ static void printAvailableDevices() {
     std::cout << std::endl;
 }
 
+static size_t getMaxWorkgroupSize() {
+    return sycl::device{sycl::default_selector{}}.get_info<sycl::info::device::max_work_group_size>();
+}
+
 } // namespace SYCL
@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "ab_comparison.h"
+
+#include "framework/configuration.h"
+#include "framework/test_case/isolated_test_runner.h"
+#include "framework/test_case/test_case_statistics.h"
+#include "framework/utility/sample_statistics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+
+using SampleGroupsCollector = IsolatedTestRunner::SampleGroupsCollector;
+
+bool AbComparison::isEnabled() {
+    const Configuration &configuration = Configuration::get();
+    const bool hasEnvironment = !configuration.abEnvA.get().empty() || !configuration.abEnvB.get().empty();
+    return hasEnvironment && !configuration.noop;
+}
+
+TestResult AbComparison::run(const std::string &testCommandLine, const std::string &testCaseNameWithConfig, const TestCaseStatistics &statistics) {
+    const Configuration &configuration = Configuration::get();
+    const std::vector<std::string> *environments[] = {&configuration.abEnvA.get(), &configuration.abEnvB.get()};
+    const char *buildNames[] = {"A", "B"};
+
+    // Processes of build A come first, followed by processes of build B, each build runs once per round
+    const size_t rounds = static_cast<size_t>(configuration.abRounds);
+    SampleGroupsCollector collector{2 * rounds};
+    for (size_t round = 0; round < rounds; round++) {
+        for (size_t position = 0; position < 2; position++) {
+            const size_t build = (round % 2 == 0) ? position : 1 - position;
+            IsolatedTestRunner::SampleGroups groups{};
+            if (const TestResult result = IsolatedTestRunner::runForSamples(testCommandLine, *environments[build], groups); result != TestResult::Success) {
+                std::cerr << testCaseNameWithConfig << ": build " << buildNames[build] << " failed in round " << round << '\n';
+                return result;
+            }
+            collector.add(build * rounds + round, groups);
+        }
+    }
+
+    collector.forEachCompleteGroup(testCaseNameWithConfig, [&](const std::string &name, const SampleGroupsCollector::CollectedGroup &group) {
+        std::vector<double> batchMeans[2] = {};
+        for (size_t processIndex = 0; processIndex < group.samplesPerProcess.size(); processIndex++) {
+            batchMeans[processIndex / rounds].push_back(SampleStatistics::getMean(group.samplesPerProcess[processIndex]));
+        }
+        const Result result = compare(group.unit, batchMeans[0], batchMeans[1]);
+        getResults()[name] = result;
+        const std::string summary = "B vs A " + SampleGroupsCollector::formatPercent(result.relativeDifference, true) + " " + formatConfidenceInterval(result.confidenceInterval);
+        statistics.printStatisticsString(name, summary);
+    });
+    return TestResult::Success;
+}
+
+void AbComparison::print() {
+    if (!isEnabled() || getResults().empty()) {
+        return;
+    }
+
+    const auto formatMean = [](double mean) {
+        std::ostringstream result{};
+        result << std::fixed << std::setprecision(3) << mean;
+        return result.str();
+    };
+
+    std::cout << "\nComparison of builds A and B, " << static_cast<size_t>(Configuration::get().abRounds) << " rounds\n";
+    TestCaseStatistics::printReportRow({"TestCase", "Unit", "A", "B", "B vs A", "95% CI", "Notes"});
+    for (const auto &[key, result] : getResults()) {
+        TestCaseStatistics::printReportRow({key, std::to_string(result.unit), formatMean(result.meanA), formatMean(result.meanB), SampleGroupsCollector::formatPercent(result.relativeDifference, true),
+                                            formatConfidenceInterval(result.confidenceInterval), getNotes(result)});
+    }
+    std::cout.flush();
+}
+
+AbComparison::Result AbComparison::compare(MeasurementUnit unit, const std::vector<double> &batchMeansA, const std::vector<double> &batchMeansB) {
+    const size_t pairsCount = std::min(batchMeansA.size(), batchMeansB.size());
+    double sumA = 0;
+    double sumB = 0;
+    for (size_t pair = 0; pair < pairsCount; pair++) {
+        sumA += batchMeansA[pair];
+        sumB += batchMeansB[pair];
+    }
+    const double meanA = sumA / pairsCount;
+    const double meanB = sumB / pairsCount;
+    const double meanDifference = meanB - meanA;
+
+    double sumOfSquares = 0;
+    for (size_t pair = 0; pair < pairsCount; pair++) {
+        const double deviation = (batchMeansB[pair] - batchMeansA[pair]) - meanDifference;
+        sumOfSquares += deviation * deviation;
+    }
+    double confidenceInterval = std::numeric_limits<double>::infinity();
+    if (pairsCount > 1) {
+        const double standardError = std::sqrt(sumOfSquares / (pairsCount - 1) / pairsCount);
+        confidenceInterval = SampleStatistics::getStudentTQuantile(pairsCount - 1) * standardError / std::abs(meanA);
+    }
+    return {unit, meanA, meanB, meanDifference / meanA, confidenceInterval};
+}
+
+std::string AbComparison::formatConfidenceInterval(double value) {
+    if (!std::isfinite(value)) {
+        return "-";
+    }
+    std::ostringstream result{};
+    result << "+-" << std::fixed << std::setprecision(2) << value * 100 << '%';
+    return result.str();
+}
+
+std::string AbComparison::getNotes(const Result &result) {
+    if (!(std::abs(result.relativeDifference) > result.confidenceInterval)) {
+        return "";
+    }
+    const bool higherIsBetter = result.unit == MeasurementUnit::GigabytesPerSecond;
+    const bool bSlower = (result.relativeDifference > 0) != higherIsBetter;
+    return bSlower ? "B slower" : "B faster";
+}
+
+std::map<std::string, AbComparison::Result> &AbComparison::getResults() {
+    static std::map<std::string, Result> results{};
+    return results;
+}
@@ -0,0 +1,46 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/enum/measurement_unit.h"
+#include "framework/test_case/test_result.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+class TestCaseStatistics;
+
+// Interleaved comparison of two builds of the driver, enabled with --abEnvA and --abEnvB, which set environment variables
+// selecting each build, e.g. LD_LIBRARY_PATH or OCL_ICD_FILENAMES. Each configuration is run in --abRounds rounds. In every
+// round both builds run a batch of --iterations iterations in fresh child processes in ABBA order, so a linear drift of
+// clocks or temperature affects both builds equally. Batch means of both builds from one round form a pair and the
+// difference between builds is reported with a 95% confidence interval of the mean paired difference.
+// Each group of results pushed by the test, e.g. time and bandwidth, is compared separately.
+class AbComparison {
+  public:
+    struct Result {
+        MeasurementUnit unit;
+        double meanA;
+        double meanB;
+        double relativeDifference; // (B - A) / A
+        double confidenceInterval; // half-width of the interval around relativeDifference
+    };
+
+    static bool isEnabled();
+    static TestResult run(const std::string &testCommandLine, const std::string &testCaseNameWithConfig, const TestCaseStatistics &statistics);
+    static void print();
+
+    // Batch means are paired by index, i.e. by the round they come from
+    static Result compare(MeasurementUnit unit, const std::vector<double> &batchMeansA, const std::vector<double> &batchMeansB);
+
+  private:
+    static std::string formatConfidenceInterval(double value);
+    static std::string getNotes(const Result &result);
+    static std::map<std::string, Result> &getResults();
+};
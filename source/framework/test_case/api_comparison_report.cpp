@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "api_comparison_report.h"
+
+#include "framework/configuration.h"
+#include "framework/test_case/test_case_statistics.h"
+
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+bool ApiComparisonReport::isEnabled() {
+    return Configuration::get().compareApis && Configuration::get().printType != Configuration::PrintType::Noop;
+}
+
+void ApiComparisonReport::addResult(const std::string &testCaseName, const std::string &config, Api api, const Result &result) {
+    const std::string key = config.empty() ? testCaseName : testCaseName + "(" + config + ")";
+    getResults()[key][api] = result;
+}
+
+void ApiComparisonReport::print() {
+    if (!isEnabled()) {
+        return;
+    }
+
+    const auto formatMean = [](const Results &results, Api api) -> std::string {
+        const auto it = results.find(api);
+        if (it == results.end()) {
+            return "-";
+        }
+        std::ostringstream result{};
+        result << std::fixed << std::setprecision(3) << it->second.mean;
+        return result.str();
+    };
+
+    std::cout << "\nComparison of APIs\n";
+    TestCaseStatistics::printReportRow({"TestCase", "Unit", "OpenCL", "LevelZero", "SYCL", "L0/OCL", "SYCL/L0", "Notes"});
+    for (const auto &[key, results] : getResults()) {
+        if (results.size() < 2) {
+            continue;
+        }
+
+        std::string notes{};
+        const std::string l0ToOcl = compare(results, Api::L0, Api::OpenCL, notes);
+        const std::string syclToL0 = compare(results, Api::SYCL, Api::L0, notes);
+        TestCaseStatistics::printReportRow({key, std::to_string(results.begin()->second.unit), formatMean(results, Api::OpenCL), formatMean(results, Api::L0),
+                                            formatMean(results, Api::SYCL), l0ToOcl, syclToL0, notes});
+    }
+    std::cout.flush();
+}
+
+std::map<std::string, ApiComparisonReport::Results> &ApiComparisonReport::getResults() {
+    static std::map<std::string, Results> results{};
+    return results;
+}
+
+bool ApiComparisonReport::isHigherBetter(MeasurementUnit unit) {
+    return unit == MeasurementUnit::GigabytesPerSecond;
+}
+
+std::string ApiComparisonReport::compare(const Results &results, Api numerator, Api denominator, std::string &notes) {
+    const auto numeratorIt = results.find(numerator);
+    const auto denominatorIt = results.find(denominator);
+    if (numeratorIt == results.end() || denominatorIt == results.end()) {
+        return "-";
+    }
+    const Result &numeratorResult = numeratorIt->second;
+    const Result &denominatorResult = denominatorIt->second;
+    if (numeratorResult.unit != denominatorResult.unit || denominatorResult.mean == 0) {
+        return "-";
+    }
+
+    const double ratio = numeratorResult.mean / denominatorResult.mean;
+    const double difference = numeratorResult.mean - denominatorResult.mean;
+    const double noise = 2 * std::hypot(numeratorResult.standardError, denominatorResult.standardError);
+    if (std::abs(difference) > noise) {
+        const bool numeratorSlower = (difference > 0) != isHigherBetter(numeratorResult.unit);
+        const Api slower = numeratorSlower ? numerator : denominator;
+        const Api faster = numeratorSlower ? denominator : numerator;
+        if (!notes.empty()) {
+            notes += "; ";
+        }
+        notes += std::to_string(slower) + " slower than " + std::to_string(faster);
+    }
+
+    std::ostringstream result{};
+    result << std::fixed << std::setprecision(3) << ratio;
+    return result.str();
+}
@@ -0,0 +1,38 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/enum/api.h"
+#include "framework/enum/measurement_unit.h"
+
+#include <cstddef>
+#include <map>
+#include <string>
+
+// Collects main results of test configurations implemented in multiple APIs and prints them side by side after all
+// tests, with ratios between APIs. Enabled with --compareApis. A difference is flagged only if it exceeds twice the
+// combined standard error of both means, so noisy results are not reported as regressions.
+class ApiComparisonReport {
+  public:
+    struct Result {
+        double mean;
+        double standardError;
+        MeasurementUnit unit;
+    };
+
+    static bool isEnabled();
+    static void addResult(const std::string &testCaseName, const std::string &config, Api api, const Result &result);
+    static void print();
+
+  private:
+    using Results = std::map<Api, Result>;
+
+    static std::map<std::string, Results> &getResults();
+    static bool isHigherBetter(MeasurementUnit unit);
+    static std::string compare(const Results &results, Api numerator, Api denominator, std::string &notes);
+};
@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "autotuner.h"
+
+#include "framework/argument/basic_argument.h"
+#include "framework/configuration.h"
+#include "framework/print_device_info.h"
+#include "framework/test_case/test_case_argument_container.h"
+#include "framework/test_case/test_case_statistics.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+bool Autotuner::isEnabled() {
+    return Configuration::get().autotune && !Configuration::get().noop;
+}
+
+bool Autotuner::isTunable(const TestCaseArgumentContainer &arguments) {
+    return findArgument(arguments, "wgs") != nullptr && findArgument(arguments, "wgc") != nullptr;
+}
+
+void Autotuner::tune(TestCaseArgumentContainer &arguments, Objective objective, const std::function<void()> &runConfiguration) {
+    Argument &workgroupSize = *findArgument(arguments, "wgs");
+    Argument &workgroupCount = *findArgument(arguments, "wgc");
+    const LaunchParameterSearch::Point start{getValue(workgroupSize), getValue(workgroupCount)};
+
+    // Sizes above the limit of the device cannot be run, so they are not searched. The limit is not known for all APIs.
+    size_t maxWorkgroupSize = DeviceInfo::getMaxWorkgroupSize(arguments.api);
+    if (maxWorkgroupSize == 0) {
+        maxWorkgroupSize = std::max(size_t{1024}, start.workgroupSize);
+    }
+    LaunchParameterSearch search{getGrid(maxWorkgroupSize, start.workgroupSize), getGrid(std::max(size_t{65536}, start.workgroupCount), start.workgroupCount)};
+    search.setMaxEvaluations(static_cast<size_t>(Configuration::get().autotuneEvaluations));
+
+    Tuning tuning{};
+    tuning.objective = objective;
+    const auto evaluate = [&](const LaunchParameterSearch::Point &point, double &value) {
+        setValue(workgroupSize, point.workgroupSize);
+        setValue(workgroupCount, point.workgroupCount);
+        getCurrentResults().clear();
+        runConfiguration();
+        if (getCurrentResults().empty()) {
+            tuning.failedCount++;
+            return false;
+        }
+
+        Result &result = getCurrentResults().back();
+        result.point = point;
+        tuning.results.push_back(result);
+        value = getObjective(result, objective);
+        return true;
+    };
+    const bool found = search.search(start, evaluate);
+    getCurrentResults().clear();
+    setValue(workgroupSize, start.workgroupSize);
+    setValue(workgroupCount, start.workgroupCount);
+
+    tuning.bestIndex = tuning.results.size();
+    for (size_t resultIndex = 0; found && resultIndex < tuning.results.size(); resultIndex++) {
+        const LaunchParameterSearch::Point &point = tuning.results[resultIndex].point;
+        if (point.workgroupSize == search.getBest().point.workgroupSize && point.workgroupCount == search.getBest().point.workgroupCount) {
+            tuning.bestIndex = resultIndex;
+        }
+    }
+    if (!tuning.results.empty() || tuning.failedCount > 0) {
+        getTunings().push_back(std::move(tuning));
+    }
+}
+
+void Autotuner::addResult(const std::string &testCaseNameWithConfig, double mean, MeasurementUnit unit) {
+    getCurrentResults().push_back({testCaseNameWithConfig, {}, mean, unit});
+}
+
+void Autotuner::print() {
+    if (!isEnabled() || getTunings().empty()) {
+        return;
+    }
+
+    const auto formatNumber = [](double value) {
+        std::ostringstream result{};
+        result << std::fixed << std::setprecision(3) << value;
+        return result.str();
+    };
+    const auto formatTimePerWorkItem = [](const Result &result, Objective objective) -> std::string {
+        if (objective != Objective::TimeOfLaunch || isHigherBetter(result.unit)) {
+            return "-";
+        }
+        std::ostringstream stream{};
+        stream << std::setprecision(4) << getObjective(result, objective);
+        return stream.str();
+    };
+
+    for (Tuning &tuning : getTunings()) {
+        std::cout << "\nAutotuning, " << tuning.results.size() + tuning.failedCount << " configurations evaluated, " << tuning.failedCount << " failed\n";
+        if (tuning.results.empty()) {
+            continue;
+        }
+
+        // Sorting by size and count shows the explored curve, the best configuration is found before sorting
+        const Result best = tuning.bestIndex < tuning.results.size() ? tuning.results[tuning.bestIndex] : Result{};
+        std::sort(tuning.results.begin(), tuning.results.end(), [](const Result &left, const Result &right) {
+            if (left.point.workgroupSize != right.point.workgroupSize) {
+                return left.point.workgroupSize < right.point.workgroupSize;
+            }
+            return left.point.workgroupCount < right.point.workgroupCount;
+        });
+        TestCaseStatistics::printReportRow({"TestCase", "Wgs", "Wgc", "Unit", "Mean", "Per work item", "Notes"});
+        for (const Result &result : tuning.results) {
+            TestCaseStatistics::printReportRow({result.name, std::to_string(result.point.workgroupSize), std::to_string(result.point.workgroupCount),
+                                                std::to_string(result.unit), formatNumber(result.mean), formatTimePerWorkItem(result, tuning.objective), result.name == best.name ? "best" : ""});
+        }
+        if (!best.name.empty()) {
+            std::cout << "Best: --wgs=" << best.point.workgroupSize << " --wgc=" << best.point.workgroupCount << '\n';
+        }
+    }
+    std::cout.flush();
+}
+
+// Some tests take a workgroup size of 0 to let the driver choose it, so their argument is not positive
+Argument *Autotuner::findArgument(const TestCaseArgumentContainer &arguments, const std::string &key) {
+    for (Argument *argument : arguments.getArguments()) {
+        if (argument->getKey() != key) {
+            continue;
+        }
+        if (dynamic_cast<PositiveIntegerArgument *>(argument) != nullptr || dynamic_cast<IntegerArgument *>(argument) != nullptr) {
+            return argument;
+        }
+    }
+    return nullptr;
+}
+
+size_t Autotuner::getValue(const Argument &argument) {
+    if (const auto positiveInteger = dynamic_cast<const PositiveIntegerArgument *>(&argument)) {
+        return *positiveInteger;
+    }
+    return static_cast<size_t>(std::max(int64_t{0}, static_cast<int64_t>(dynamic_cast<const IntegerArgument &>(argument))));
+}
+
+void Autotuner::setValue(Argument &argument, size_t value) {
+    if (const auto positiveInteger = dynamic_cast<PositiveIntegerArgument *>(&argument)) {
+        *positiveInteger = value;
+    } else {
+        dynamic_cast<IntegerArgument &>(argument) = static_cast<int64_t>(value);
+    }
+}
+
+std::vector<size_t> Autotuner::getGrid(size_t max, size_t startValue) {
+    std::vector<size_t> result = LaunchParameterSearch::getPowersOfTwo(1, max);
+    if (std::find(result.begin(), result.end(), startValue) == result.end()) {
+        result.insert(std::upper_bound(result.begin(), result.end(), startValue), startValue);
+    }
+    return result;
+}
+
+// Time of a launch grows with the number of work items, so a smaller launch always takes less time. It is compared per
+// work item instead, which finds the highest throughput. Bandwidth is already a rate, it is compared as is.
+double Autotuner::getObjective(const Result &result, Objective objective) {
+    if (isHigherBetter(result.unit)) {
+        return -result.mean;
+    }
+    if (objective == Objective::TimeOfLaunch) {
+        return result.mean / static_cast<double>(result.point.workgroupSize * result.point.workgroupCount);
+    }
+    return result.mean;
+}
+
+bool Autotuner::isHigherBetter(MeasurementUnit unit) {
+    return unit == MeasurementUnit::GigabytesPerSecond || unit == MeasurementUnit::GigabytesPerSecondPerWatt;
+}
+
+std::vector<Autotuner::Result> &Autotuner::getCurrentResults() {
+    static std::vector<Result> results{};
+    return results;
+}
+
+std::vector<Autotuner::Tuning> &Autotuner::getTunings() {
+    static std::vector<Tuning> tunings{};
+    return tunings;
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/enum/measurement_unit.h"
+#include "framework/utility/launch_parameter_search.h"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+struct TestCaseArgumentContainer;
+struct Argument;
+
+// Searches for the workgroup size and count with the best result of a test, enabled with --autotune. Works for any test
+// with --wgs and --wgc arguments. The test itself is the objective, each evaluated configuration is run and printed as
+// usual. Tests declare how their result depends on the launch, tests which do not are rejected. Workgroup sizes are
+// powers of two up to the limit of the device and counts are powers of two, both including the values passed on the
+// command line, from which the search starts. See LaunchParameterSearch for the algorithm. All evaluated configurations
+// are reported at the end, with the best one marked.
+class Autotuner {
+  public:
+    enum class Objective {
+        None,         // result does not depend on work of the kernel, e.g. submission overhead, the test cannot be autotuned
+        TimeOfLaunch, // each work item does the same work, so time is compared per work item, wgs * wgc
+        PerWorkItem,  // result is already normalized per work item, e.g. time of an atomic operation, and compared as is
+    };
+
+    static bool isEnabled();
+    static bool isTunable(const TestCaseArgumentContainer &arguments);
+    static void tune(TestCaseArgumentContainer &arguments, Objective objective, const std::function<void()> &runConfiguration);
+    static void addResult(const std::string &testCaseNameWithConfig, double mean, MeasurementUnit unit);
+    static void print();
+
+  private:
+    struct Result {
+        std::string name;
+        LaunchParameterSearch::Point point;
+        double mean;
+        MeasurementUnit unit;
+    };
+    struct Tuning {
+        Objective objective;
+        std::vector<Result> results;
+        size_t failedCount;
+        size_t bestIndex; // equal to results.size() if all configurations failed
+    };
+
+    static Argument *findArgument(const TestCaseArgumentContainer &arguments, const std::string &key);
+    static size_t getValue(const Argument &argument);
+    static void setValue(Argument &argument, size_t value);
+    static std::vector<size_t> getGrid(size_t max, size_t startValue);
+    static double getObjective(const Result &result, Objective objective);
+    static bool isHigherBetter(MeasurementUnit unit);
+    static std::vector<Result> &getCurrentResults();
+    static std::vector<Tuning> &getTunings();
+};
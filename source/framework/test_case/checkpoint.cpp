@@ -0,0 +1,196 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "checkpoint.h"
+
+#include "framework/configuration.h"
+#include "framework/utility/error.h"
+#include "framework/utility/journal_file.h"
+#include "framework/utility/working_directory_helper.h"
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+// Passes output to the original buffer of std::cout and keeps a copy of it
+class RecordingStreamBuffer : public std::streambuf {
+  public:
+    explicit RecordingStreamBuffer(std::streambuf *destination) : destination(destination) {}
+    const std::string &getRecorded() const { return recorded; }
+
+  protected:
+    int overflow(int character) override {
+        if (character == traits_type::eof()) {
+            return traits_type::not_eof(character);
+        }
+        recorded.push_back(traits_type::to_char_type(character));
+        return destination->sputc(traits_type::to_char_type(character));
+    }
+
+    std::streamsize xsputn(const char *data, std::streamsize count) override {
+        recorded.append(data, static_cast<size_t>(count));
+        return destination->sputn(data, count);
+    }
+
+    int sync() override {
+        return destination->pubsync();
+    }
+
+  private:
+    std::streambuf *destination;
+    std::string recorded{};
+};
+
+bool Checkpoint::isEnabled() {
+    // Nooped tests are not run, so there is nothing to resume
+    return !static_cast<const std::string &>(Configuration::get().checkpoint).empty() && !Configuration::get().noop;
+}
+
+bool Checkpoint::load(std::string &error) {
+    const std::string &filePath = Configuration::get().checkpoint;
+    auto checkpoint = std::unique_ptr<Checkpoint>(new Checkpoint());
+
+    // Read complete entries. The last line is not terminated only if its append was interrupted.
+    std::ifstream file{filePath, std::ios::in | std::ios::binary};
+    size_t validSize = 0;
+    std::string line{};
+    while (std::getline(file, line) && !file.eof()) {
+        validSize += line.size() + 1;
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        std::vector<std::string> fields{};
+        std::istringstream lineStream{line};
+        for (std::string field{}; std::getline(lineStream, field, '\t');) {
+            fields.push_back(field);
+        }
+        if (fields.size() != 2 && fields.size() != 3) {
+            error = "Invalid entry in checkpoint file " + filePath;
+            return false;
+        }
+        checkpoint->completedOutputs[unescape(fields[0])] = fields.size() == 3 ? unescape(fields[2]) : "";
+    }
+    file.close();
+
+    // Drop the torn entry, so new entries are appended after the last complete one
+    std::error_code errorCode{};
+    if (const auto fileSize = FileSystem::file_size(filePath, errorCode); !errorCode && fileSize > validSize) {
+        FileSystem::resize_file(filePath, validSize, errorCode);
+        if (errorCode) {
+            error = "Could not truncate checkpoint file " + filePath;
+            return false;
+        }
+    }
+
+    checkpoint->journal = std::make_unique<JournalFile>(filePath);
+    if (!checkpoint->journal->isValid() || (validSize == 0 && !checkpoint->journal->append(std::string(fileHeader) + '\n'))) {
+        error = "Could not open checkpoint file " + filePath;
+        return false;
+    }
+
+    getInstance() = std::move(checkpoint);
+    return true;
+}
+
+Checkpoint &Checkpoint::get() {
+    FATAL_ERROR_IF(getInstance() == nullptr, "Checkpoint was not loaded");
+    return *getInstance();
+}
+
+Checkpoint::~Checkpoint() = default;
+
+bool Checkpoint::printCompleted(const std::string &commandLine) const {
+    const auto it = completedOutputs.find(commandLine);
+    if (it == completedOutputs.end()) {
+        return false;
+    }
+    std::cout << it->second << std::flush;
+    return true;
+}
+
+void Checkpoint::beginRecording() {
+    FATAL_ERROR_IF(recordingBuffer != nullptr, "Checkpoint is already recording");
+    originalBuffer = std::cout.rdbuf();
+    recordingBuffer = std::make_unique<RecordingStreamBuffer>(originalBuffer);
+    std::cout.rdbuf(recordingBuffer.get());
+}
+
+void Checkpoint::endRecording(const std::string &commandLine, TestResult result) {
+    FATAL_ERROR_IF(recordingBuffer == nullptr, "Checkpoint is not recording");
+    std::cout.flush();
+    std::cout.rdbuf(originalBuffer);
+    const std::string output = static_cast<RecordingStreamBuffer *>(recordingBuffer.get())->getRecorded();
+    recordingBuffer.reset();
+
+    // Skipped configurations are cheap to check again, only those which were actually run are recorded
+    if (result != TestResult::Success && TestResultHelper::getTestResultInfo(result).wasTestSkipped) {
+        return;
+    }
+
+    const std::string resultString = result == TestResult::Success ? "SUCCESS" : TestResultHelper::getTestResultInfo(result).stringMessage;
+    const std::string entry = escape(commandLine) + '\t' + escape(resultString) + '\t' + escape(output) + '\n';
+    if (!journal->append(entry)) {
+        std::cerr << "WARNING: Could not append to checkpoint file " << static_cast<const std::string &>(Configuration::get().checkpoint) << '\n';
+    }
+    completedOutputs[commandLine] = output;
+}
+
+std::unique_ptr<Checkpoint> &Checkpoint::getInstance() {
+    static std::unique_ptr<Checkpoint> instance{};
+    return instance;
+}
+
+std::string Checkpoint::escape(const std::string &field) {
+    std::string result{};
+    result.reserve(field.size());
+    for (const char character : field) {
+        switch (character) {
+        case '\\':
+            result += "\\\\";
+            break;
+        case '\t':
+            result += "\\t";
+            break;
+        case '\n':
+            result += "\\n";
+            break;
+        case '\r':
+            result += "\\r";
+            break;
+        default:
+            result += character;
+        }
+    }
+    return result;
+}
+
+std::string Checkpoint::unescape(const std::string &field) {
+    std::string result{};
+    result.reserve(field.size());
+    for (size_t i = 0; i < field.size(); i++) {
+        if (field[i] != '\\' || i + 1 == field.size()) {
+            result += field[i];
+            continue;
+        }
+        switch (field[++i]) {
+        case 't':
+            result += '\t';
+            break;
+        case 'n':
+            result += '\n';
+            break;
+        case 'r':
+            result += '\r';
+            break;
+        default:
+            result += field[i];
+        }
+    }
+    return result;
+}
@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/test_case/test_result.h"
+
+#include <map>
+#include <memory>
+#include <streambuf>
+#include <string>
+
+class JournalFile;
+
+// Journal of completed test configurations, enabled with --checkpoint. After each configuration is run, its command
+// line, result and printed output are appended to the journal and synced to the storage. When the benchmark is started
+// again with the same journal, e.g. after its node was preempted, completed configurations are not run again. Their
+// output is printed from the journal instead, so the resumed run prints all results in the original order. An entry
+// torn by an interruption during its append is discarded and its configuration is run again.
+class Checkpoint {
+  public:
+    static constexpr const char *fileHeader = "#compute-benchmarks-checkpoint\t1";
+
+    static bool isEnabled();
+    static bool load(std::string &error);
+    static Checkpoint &get();
+    ~Checkpoint();
+
+    size_t getCompletedCount() const { return completedOutputs.size(); }
+    bool printCompleted(const std::string &commandLine) const;
+
+    // Output printed to std::cout between these calls is stored in the journal along with the result
+    void beginRecording();
+    void endRecording(const std::string &commandLine, TestResult result);
+
+  private:
+    Checkpoint() = default;
+
+    static std::unique_ptr<Checkpoint> &getInstance();
+    static std::string escape(const std::string &field);
+    static std::string unescape(const std::string &field);
+
+    std::map<std::string, std::string> completedOutputs{};
+    std::unique_ptr<JournalFile> journal{};
+    std::unique_ptr<std::streambuf> recordingBuffer{};
+    std::streambuf *originalBuffer = nullptr;
+};
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "configuration_durations.h"
+
+#include "framework/benchmark_info.h"
+#include "framework/configuration.h"
+#include "framework/test_case/isolated_test_runner.h"
+#include "framework/utility/error.h"
+
+#include <fstream>
+#include <iomanip>
+
+bool ConfigurationDurations::isEnabled() {
+    // Child processes are timed by their parent, nooped configurations are not run at all
+    const Configuration &configuration = Configuration::get();
+    const bool isUsed = configuration.progress || configuration.timeBudget > 0;
+    return isUsed && !configuration.noop && !IsolatedTestRunner::isChildProcess();
+}
+
+ConfigurationDurations &ConfigurationDurations::get() {
+    static ConfigurationDurations durations{};
+    return durations;
+}
+
+void ConfigurationDurations::load() {
+    std::ifstream file{getFile()};
+    Duration duration{};
+    std::string commandLine{};
+    while (file >> duration.seconds >> duration.iterations && std::getline(file >> std::ws, commandLine)) {
+        if (duration.iterations > 0) {
+            loadedDurations[commandLine] = duration;
+        }
+    }
+}
+
+void ConfigurationDurations::save() const {
+    std::map<std::string, Duration> durations = loadedDurations;
+    for (const auto &[commandLine, duration] : recordedDurations) {
+        durations[commandLine] = duration;
+    }
+
+    std::ofstream file{getFile(), std::ios::out | std::ios::trunc};
+    for (const auto &[commandLine, duration] : durations) {
+        file << std::setprecision(6) << duration.seconds << '\t' << duration.iterations << '\t' << commandLine << '\n';
+    }
+    if (!file.good()) {
+        printMessageLine("WARNING", "Could not write configuration durations to " + getFile());
+    }
+}
+
+void ConfigurationDurations::record(const std::string &commandLine, double seconds, size_t iterations) {
+    Duration &duration = recordedDurations[commandLine];
+    duration.seconds += seconds;
+    duration.iterations += iterations;
+}
+
+double ConfigurationDurations::getSecondsPerIteration(const std::string &commandLine) const {
+    for (const auto *durations : {&recordedDurations, &loadedDurations}) {
+        if (const auto it = durations->find(commandLine); it != durations->end() && it->second.iterations > 0) {
+            return it->second.seconds / static_cast<double>(it->second.iterations);
+        }
+    }
+    return -1;
+}
+
+std::string ConfigurationDurations::getFile() {
+    const std::string &file = Configuration::get().durationCache;
+    return file.empty() ? BenchmarkInfo::get().getBenchmarkName() + "_durations.txt" : file;
+}
@@ -0,0 +1,42 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <map>
+#include <string>
+
+// Durations of test configurations, identified by their command lines, e.g. "--test=UsmCopy --api=l0 --size=4KB". Each
+// configuration run by this process is timed along with the number of its iterations. Durations are loaded from
+// --durationCache at the start and written back at the end of the run, keeping the ones of configurations which were
+// not run. They are used by --progress to estimate time left and by --timeBudget to split iterations between
+// configurations.
+class ConfigurationDurations {
+  public:
+    static bool isEnabled();
+    static ConfigurationDurations &get();
+
+    void load();
+    void save() const;
+
+    // Configurations run many times, e.g. in rounds of --roundRobin, accumulate their durations and iterations
+    void record(const std::string &commandLine, double seconds, size_t iterations);
+
+    // Negative if the configuration was not run by this or a previous run
+    double getSecondsPerIteration(const std::string &commandLine) const;
+
+  private:
+    struct Duration {
+        double seconds = 0;
+        size_t iterations = 0;
+    };
+
+    static std::string getFile();
+
+    std::map<std::string, Duration> loadedDurations = {};
+    std::map<std::string, Duration> recordedDurations = {};
+};
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "execution_order.h"
+
+#include "framework/configuration.h"
+#include "framework/test_case/test_case_statistics.h"
+
+#include <iostream>
+
+bool ExecutionOrder::isShuffleEnabled() {
+    return Configuration::get().shuffle;
+}
+
+uint32_t ExecutionOrder::getSeed() {
+    // Seed is drawn once per run, so all shuffles of the run can be repeated with it
+    State &state = getState();
+    if (state.seed == 0) {
+        state.seed = static_cast<uint32_t>(static_cast<size_t>(Configuration::get().seed));
+        while (state.seed == 0) {
+            state.seed = std::random_device{}();
+        }
+        std::cerr << "Shuffling test configurations with --seed=" << state.seed << std::endl;
+    }
+    return state.seed;
+}
+
+bool ExecutionOrder::isRoundRobinEnabled() {
+    return Configuration::get().roundRobin > 0 && !Configuration::get().noop;
+}
+
+size_t ExecutionOrder::getRoundsCount() {
+    if (!isRoundRobinEnabled()) {
+        return 1;
+    }
+    const size_t iterations = Configuration::get().iterations;
+    const size_t roundIterations = Configuration::get().roundRobin;
+    return (iterations + roundIterations - 1) / roundIterations;
+}
+
+void ExecutionOrder::beginRound(size_t round) {
+    State &state = getState();
+    state.round = round;
+    if (round == 0) {
+        state.configurations.clear();
+    }
+}
+
+bool ExecutionOrder::isLastRound() {
+    return getState().round + 1 >= getRoundsCount();
+}
+
+size_t ExecutionOrder::getRoundIterations() {
+    // Last round runs the remainder, so each configuration runs exactly --iterations iterations in total
+    const size_t iterations = Configuration::get().iterations;
+    const size_t roundIterations = Configuration::get().roundRobin;
+    return std::min(roundIterations, iterations - getState().round * roundIterations);
+}
+
+bool ExecutionOrder::beginConfiguration(const std::string &testCaseNameWithConfig) {
+    State &state = getState();
+    const auto [it, inserted] = state.configurations.try_emplace(testCaseNameWithConfig);
+    ConfigurationState &configuration = it->second;
+    if (configuration.finished || (!inserted && configuration.lastRound == state.round)) {
+        return false;
+    }
+    configuration.lastRound = state.round;
+    return true;
+}
+
+TestCaseStatistics &ExecutionOrder::getStatistics(const std::string &testCaseNameWithConfig) {
+    auto &statistics = getState().configurations[testCaseNameWithConfig].statistics;
+    if (statistics == nullptr) {
+        statistics = std::make_unique<TestCaseStatistics>(Configuration::get().iterations, Configuration::get().printType);
+    }
+    return *statistics;
+}
+
+void ExecutionOrder::setFinished(const std::string &testCaseNameWithConfig) {
+    ConfigurationState &configuration = getState().configurations[testCaseNameWithConfig];
+    configuration.statistics.reset();
+    configuration.finished = true;
+}
+
+ExecutionOrder::State &ExecutionOrder::getState() {
+    static State state{};
+    return state;
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+class TestCaseStatistics;
+
+// Order in which test configurations are run. By default it is fixed, so each configuration inherits cache, frequency
+// and driver state from the same predecessor. --shuffle randomizes the order with a seed printed at the start, which can
+// be passed to --seed to repeat it. --roundRobin runs iterations of all configurations of a run (a test plan, all tests
+// or sweep points of a single test) in rounds with the given number of iterations, so each configuration is run many
+// times between the others. Samples of all rounds are accumulated in statistics of the configuration and printed in
+// the last round. A configuration which fails in any round is printed as failed and not run in the following rounds.
+class ExecutionOrder {
+  public:
+    static bool isShuffleEnabled();
+    static uint32_t getSeed();
+    template <typename T>
+    static void shuffle(std::vector<T> &items, size_t round) {
+        std::mt19937 engine{getSeed() + static_cast<uint32_t>(round)};
+        std::shuffle(items.begin(), items.end(), engine);
+    }
+
+    static bool isRoundRobinEnabled();
+    static size_t getRoundsCount();
+    static void beginRound(size_t round);
+    static bool isLastRound();
+    static size_t getRoundIterations();
+
+    // Configurations are identified by their names with config. A configuration listed more than once, e.g. by two
+    // tests of googletest, is run only once in each round.
+    static bool beginConfiguration(const std::string &testCaseNameWithConfig);
+    static TestCaseStatistics &getStatistics(const std::string &testCaseNameWithConfig);
+    static void setFinished(const std::string &testCaseNameWithConfig);
+
+  private:
+    struct ConfigurationState {
+        std::unique_ptr<TestCaseStatistics> statistics = {};
+        size_t lastRound = 0;
+        bool finished = false;
+    };
+    struct State {
+        uint32_t seed = 0;
+        size_t round = 0;
+        std::map<std::string, ConfigurationState> configurations = {};
+    };
+    static State &getState();
+};
@@ -0,0 +1,274 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "isolated_test_runner.h"
+
+#include "framework/argument/abstract/argument.h"
+#include "framework/configuration.h"
+#include "framework/utility/process.h"
+#include "framework/utility/string_utils.h"
+#include "framework/utility/working_directory_helper.h"
+#include "framework/workload/workload_io.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+
+bool IsolatedTestRunner::isEnabled() {
+    // Nooped tests do not touch the driver, there is nothing to isolate
+    return Configuration::get().isolate && !Configuration::get().noop;
+}
+
+bool IsolatedTestRunner::isChildProcess() {
+    return Configuration::get().exitWithTestResult;
+}
+
+void IsolatedTestRunner::setCommandLine(int argc, char **argv) {
+    auto &forwardedArguments = getForwardedArguments();
+    forwardedArguments.clear();
+    for (int argIndex = 1; argIndex < argc; argIndex++) {
+        if (isForwardedArgument(argv[argIndex])) {
+            forwardedArguments.push_back(argv[argIndex]);
+        }
+    }
+}
+
+TestResult IsolatedTestRunner::run(const std::string &testCommandLine, SampleGroups *groups) {
+    auto process = createProcess(testCommandLine);
+    process->setPassPipesAsArguments(groups != nullptr);
+    process->run();
+    const TestResult result = waitForResult(*process);
+    std::cout << process->getStdout() << std::flush;
+    if (result != TestResult::Success || groups == nullptr) {
+        return result;
+    }
+    return readSamples(*process, testCommandLine, *groups);
+}
+
+std::unique_ptr<Process> IsolatedTestRunner::createProcess(const std::string &testCommandLine) {
+    auto process = std::make_unique<Process>(WorkingDirectoryHelper::getExeLocation().string());
+    process->setPassPipesAsArguments(false);
+
+    // Arguments are passed as --key=value, while Process expects them split
+    const auto addArgument = [&process](const std::string &argument) {
+        const auto keyBegin = argument.find_first_not_of('-');
+        const auto separator = argument.find('=');
+        if (separator == std::string::npos) {
+            process->addArgument(argument.substr(keyBegin), "");
+        } else {
+            process->addArgument(argument.substr(keyBegin, separator - keyBegin), argument.substr(separator + 1));
+        }
+    };
+    for (const auto &argument : splitString(testCommandLine)) {
+        addArgument(argument);
+    }
+    for (const auto &argument : getForwardedArguments()) {
+        addArgument(argument);
+    }
+    // Iterations may differ from the command line of the parent, e.g. they are assigned to each configuration by --timeBudget
+    process->addArgument("iterations", std::to_string(static_cast<size_t>(Configuration::get().iterations)));
+    process->addArgument("noHeaders", "");
+    process->addArgument("noColumnNames", "");
+    process->addArgument("exitWithTestResult", "");
+    return process;
+}
+
+TestResult IsolatedTestRunner::waitForResult(Process &process) {
+    // Output is drained while waiting also without a timeout, so children passing many samples do not block
+    const auto timeoutSeconds = std::chrono::seconds(static_cast<size_t>(Configuration::get().testTimeout));
+    const auto timeout = timeoutSeconds.count() > 0 ? std::chrono::milliseconds(timeoutSeconds) : std::chrono::milliseconds::max();
+    if (!process.waitForFinish(timeout)) {
+        process.terminate();
+        return TestResult::Timeout;
+    }
+    return process.getResult();
+}
+
+TestResult IsolatedTestRunner::runForSamples(const std::string &testCommandLine, const std::vector<std::string> &environment, SampleGroups &groups) {
+    auto process = createProcess(testCommandLine);
+    process->setPassPipesAsArguments(true);
+    process->addArgument("samplesOnly", "");
+    for (const auto &variable : environment) {
+        const auto separator = variable.find('=');
+        process->addEnvVariable(variable.substr(0, separator), separator == std::string::npos ? "" : variable.substr(separator + 1));
+    }
+    process->run();
+    const TestResult result = waitForResult(*process);
+    if (result != TestResult::Success) {
+        return result;
+    }
+    return readSamples(*process, testCommandLine, groups);
+}
+
+bool IsolatedTestRunner::isSamplesChildProcess() {
+    return Configuration::get().exitWithTestResult && Configuration::get().measurementPipe >= 0;
+}
+
+bool IsolatedTestRunner::isSamplesOnlyChildProcess() {
+    return isSamplesChildProcess() && Configuration::get().samplesOnly;
+}
+
+TestResult IsolatedTestRunner::readSamples(Process &process, const std::string &testCommandLine, SampleGroups &groups) {
+    const std::string &measurements = process.getMeasurements();
+    if (measurements.rfind(samplesHeader) == std::string::npos) {
+        std::cerr << "Child process did not pass any samples: " << testCommandLine << '\n';
+        return TestResult::Error;
+    }
+    if (!parseSamples(measurements, groups)) {
+        std::cerr << "Child process passed malformed or no samples: " << testCommandLine << '\n';
+        return TestResult::Error;
+    }
+    return TestResult::Success;
+}
+
+void IsolatedTestRunner::writeSamples(const SampleGroups &groups) {
+    WorkloadArgumentContainer pipes{};
+    pipes.synchronizationPipeIn = static_cast<int64_t>(Configuration::get().synchronizationPipeIn);
+    pipes.synchronizationPipeOut = static_cast<int64_t>(Configuration::get().synchronizationPipeOut);
+    pipes.measurementPipe = static_cast<int64_t>(Configuration::get().measurementPipe);
+    WorkloadIo::create(pipes)->writeToMeasurements(formatSamples(groups));
+}
+
+std::string IsolatedTestRunner::formatSamples(const SampleGroups &groups) {
+    std::ostringstream measurements{};
+    measurements << std::setprecision(std::numeric_limits<double>::max_digits10) << samplesHeader << groups.size() << '\n';
+    for (const SampleGroup &group : groups) {
+        measurements << static_cast<int>(group.unit) << '\t' << group.description << '\t';
+        for (size_t sampleIndex = 0; sampleIndex < group.samples.size(); sampleIndex++) {
+            measurements << (sampleIndex == 0 ? "" : " ") << group.samples[sampleIndex];
+        }
+        measurements << '\n';
+    }
+    return measurements.str();
+}
+
+bool IsolatedTestRunner::parseSamples(const std::string &measurements, SampleGroups &groups) {
+    // Samples are written last, as a header with the number of groups followed by a line for each group. Anything before
+    // the header is not a part of them.
+    groups.clear();
+    const auto headerPosition = measurements.rfind(samplesHeader);
+    if (headerPosition == std::string::npos) {
+        return false;
+    }
+    std::istringstream stream{measurements.substr(headerPosition + samplesHeader.size())};
+    size_t groupsCount = 0;
+    stream >> groupsCount;
+    stream.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+
+    for (std::string line{}; groups.size() < groupsCount && std::getline(stream, line);) {
+        const auto unitEnd = line.find('\t');
+        const auto descriptionEnd = line.find('\t', unitEnd + 1);
+        if (unitEnd == std::string::npos || descriptionEnd == std::string::npos) {
+            break;
+        }
+        SampleGroup group{line.substr(unitEnd + 1, descriptionEnd - unitEnd - 1), static_cast<MeasurementUnit>(std::atoi(line.substr(0, unitEnd).c_str())), {}};
+        for (const auto &value : splitString(line.substr(descriptionEnd + 1))) {
+            group.samples.push_back(std::atof(value.c_str()));
+        }
+        groups.push_back(std::move(group));
+    }
+    return groups.size() == groupsCount && !groups.empty();
+}
+
+std::string IsolatedTestRunner::getSampleGroupName(const std::string &testCaseNameWithConfig, const std::string &description) {
+    return description.empty() ? testCaseNameWithConfig : testCaseNameWithConfig + " " + description;
+}
+
+void IsolatedTestRunner::SampleGroupsCollector::add(size_t processIndex, SampleGroups &processGroups) {
+    for (auto &group : processGroups) {
+        CollectedGroup &collected = groups[group.description];
+        collected.unit = group.unit;
+        collected.samplesPerProcess.resize(processesCount);
+        collected.samplesPerProcess[processIndex] = std::move(group.samples);
+        collected.reportingProcesses++;
+    }
+}
+
+void IsolatedTestRunner::SampleGroupsCollector::forEachCompleteGroup(const std::string &testCaseNameWithConfig, const GroupCallback &callback) const {
+    for (const auto &[description, collected] : groups) {
+        if (collected.reportingProcesses != processesCount) {
+            std::cerr << testCaseNameWithConfig << ": results \"" << description << "\" were not reported by all processes, skipping them\n";
+            continue;
+        }
+        callback(getSampleGroupName(testCaseNameWithConfig, description), collected);
+    }
+}
+
+std::string IsolatedTestRunner::SampleGroupsCollector::formatPercent(double value, bool showSign) {
+    std::ostringstream result{};
+    if (showSign) {
+        result << std::showpos;
+    }
+    result << std::fixed << std::setprecision(2) << value * 100 << '%';
+    return result.str();
+}
+
+void IsolatedTestRunner::setChildResult(Api api, TestResult result) {
+    // Child process runs a single configuration, results for other apis are all SkippedApi
+    if (api == Configuration::get().selectedApi) {
+        getChildResult() = result;
+    }
+}
+
+int IsolatedTestRunner::getChildExitCode() {
+    return static_cast<int>(getChildResult());
+}
+
+bool IsolatedTestRunner::isForwardedArgument(const std::string &argument) {
+    const static std::vector<std::string> parentOnlyKeys = {
+        "test",
+        "api",
+        "iterations",
+        "isolate",
+        "testTimeout",
+        "exitWithTestResult",
+        "samplesOnly",
+        "noHeaders",
+        "noColumnNames",
+        "interactivePrints",
+        "trace",
+        "compareApis",
+        "progress",
+        "durationCache",
+        "exportPlan",
+        "runPlan",
+        "checkpoint",
+        "abEnvA",
+        "abEnvB",
+        "abRounds",
+        "repeatProcess",
+        "timeBudget",
+        "shuffle",
+        "seed",
+        "roundRobin",
+        "autotune",
+        "autotuneEvaluations",
+    };
+
+    // Only global arguments are forwarded, arguments of the test come from its command line
+    const auto keyBegin = argument.find_first_not_of('-');
+    const auto key = argument.substr(keyBegin, argument.find('=') - keyBegin);
+    if (std::find(parentOnlyKeys.begin(), parentOnlyKeys.end(), key) != parentOnlyKeys.end()) {
+        return false;
+    }
+    const auto &globalArguments = Configuration::get().getArguments();
+    const auto isKeyMatching = [&key](const Argument *globalArgument) { return globalArgument->getKey() == key; };
+    return std::find_if(globalArguments.begin(), globalArguments.end(), isKeyMatching) != globalArguments.end();
+}
+
+std::vector<std::string> &IsolatedTestRunner::getForwardedArguments() {
+    static std::vector<std::string> forwardedArguments{};
+    return forwardedArguments;
+}
+
+TestResult &IsolatedTestRunner::getChildResult() {
+    static TestResult childResult = TestResult::Error;
+    return childResult;
+}
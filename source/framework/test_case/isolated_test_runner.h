@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/enum/api.h"
+#include "framework/enum/measurement_unit.h"
+#include "framework/test_case/test_result.h"
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+class Process;
+
+// Runs test configurations in child processes, enabled with --isolate. Each configuration is run by the benchmark itself
+// in single-test mode with --exitWithTestResult, so a crash or a hang of the driver ends only the child process. Parent
+// reports them as CRASH or TIMEOUT and continues with the next configuration. Child prints only results of successful
+// runs, all other results are printed by the parent, so the output looks the same as in a run without isolation.
+class IsolatedTestRunner {
+  public:
+    struct SampleGroup {
+        std::string description;
+        MeasurementUnit unit;
+        std::vector<double> samples;
+    };
+    using SampleGroups = std::vector<SampleGroup>;
+
+    // Samples of each group passed by several child processes running the same configuration, used by modes comparing
+    // such processes. Groups are matched by description, so e.g. "time" and "bw" are collected separately.
+    class SampleGroupsCollector {
+      public:
+        struct CollectedGroup {
+            MeasurementUnit unit = MeasurementUnit::Unknown;
+            std::vector<std::vector<double>> samplesPerProcess = {};
+            size_t reportingProcesses = 0;
+        };
+        using GroupCallback = std::function<void(const std::string &name, const CollectedGroup &group)>;
+
+        explicit SampleGroupsCollector(size_t processesCount) : processesCount(processesCount) {}
+
+        void add(size_t processIndex, SampleGroups &groups);
+
+        // Calls back for each group reported by all processes with its name from getSampleGroupName, other ones are skipped
+        void forEachCompleteGroup(const std::string &testCaseNameWithConfig, const GroupCallback &callback) const;
+
+        static std::string formatPercent(double value, bool showSign);
+
+      private:
+        const size_t processesCount;
+        std::map<std::string, CollectedGroup> groups = {};
+    };
+
+    static bool isEnabled();
+    static bool isChildProcess();
+
+    // Global arguments of the parent are passed to child processes, except the ones handled only by the parent
+    static void setCommandLine(int argc, char **argv);
+
+    // Child process prints its results. If groups are passed, it also passes its samples for reports of the parent.
+    static TestResult run(const std::string &testCommandLine, SampleGroups *groups);
+
+    // Child process running a configuration, used also by other modes running tests in child processes
+    static std::unique_ptr<Process> createProcess(const std::string &testCommandLine);
+    static TestResult waitForResult(Process &process);
+
+    // Child process passing samples to the parent through the measurement pipe instead of printing them. Every group of
+    // results pushed by the test is passed, e.g. "time" and "bw". The main result is the group with empty description.
+    static TestResult runForSamples(const std::string &testCommandLine, const std::vector<std::string> &environment, SampleGroups &groups);
+    static bool isSamplesChildProcess();
+    static bool isSamplesOnlyChildProcess();
+    static void writeSamples(const SampleGroups &groups);
+    static std::string formatSamples(const SampleGroups &groups);
+    static bool parseSamples(const std::string &measurements, SampleGroups &groups);
+    static std::string getSampleGroupName(const std::string &testCaseNameWithConfig, const std::string &description);
+
+    static void setChildResult(Api api, TestResult result);
+    static int getChildExitCode();
+
+  private:
+    static inline const std::string samplesHeader = "samples\t";
+
+    static TestResult readSamples(Process &process, const std::string &testCommandLine, SampleGroups &groups);
+
+    static bool isForwardedArgument(const std::string &argument);
+    static std::vector<std::string> &getForwardedArguments();
+    static TestResult &getChildResult();
+};
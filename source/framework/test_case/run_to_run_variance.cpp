@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "run_to_run_variance.h"
+
+#include "framework/configuration.h"
+#include "framework/test_case/isolated_test_runner.h"
+#include "framework/test_case/test_case_statistics.h"
+#include "framework/utility/sample_statistics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+using SampleGroupsCollector = IsolatedTestRunner::SampleGroupsCollector;
+
+bool RunToRunVariance::isEnabled() {
+    return Configuration::get().repeatProcess > 1 && !Configuration::get().noop;
+}
+
+TestResult RunToRunVariance::run(const std::string &testCommandLine, const std::string &testCaseNameWithConfig, const TestCaseStatistics &statistics) {
+    const size_t processesCount = static_cast<size_t>(Configuration::get().repeatProcess);
+    SampleGroupsCollector collector{processesCount};
+    for (size_t processIndex = 0; processIndex < processesCount; processIndex++) {
+        IsolatedTestRunner::SampleGroups groups{};
+        if (const TestResult result = IsolatedTestRunner::runForSamples(testCommandLine, {}, groups); result != TestResult::Success) {
+            std::cerr << testCaseNameWithConfig << ": process " << processIndex << " failed\n";
+            return result;
+        }
+        collector.add(processIndex, groups);
+    }
+
+    collector.forEachCompleteGroup(testCaseNameWithConfig, [&](const std::string &name, const SampleGroupsCollector::CollectedGroup &group) {
+        const Result result = analyze(group.unit, group.samplesPerProcess);
+        getResults()[name] = result;
+        std::ostringstream summary{};
+        summary << "within " << SampleGroupsCollector::formatPercent(result.withinDeviation, false)
+                << " between " << SampleGroupsCollector::formatPercent(result.betweenDeviation, false)
+                << " F=" << std::fixed << std::setprecision(2) << result.fStatistic;
+        statistics.printStatisticsString(name, summary.str());
+    });
+    return TestResult::Success;
+}
+
+void RunToRunVariance::print() {
+    if (!isEnabled() || getResults().empty()) {
+        return;
+    }
+
+    const auto formatNumber = [](double value, int precision) {
+        std::ostringstream result{};
+        result << std::fixed << std::setprecision(precision) << value;
+        return result.str();
+    };
+
+    std::cout << "\nRun-to-run variance, " << static_cast<size_t>(Configuration::get().repeatProcess) << " processes\n";
+    TestCaseStatistics::printReportRow({"TestCase", "Unit", "Mean", "Within", "Between", "Between share", "F", "Processes for 1%"});
+    for (const auto &[key, result] : getResults()) {
+        const double withinVariance = result.withinDeviation * result.withinDeviation;
+        const double betweenVariance = result.betweenDeviation * result.betweenDeviation;
+        const double totalVariance = withinVariance + betweenVariance;
+        const double betweenShare = totalVariance > 0 ? betweenVariance / totalVariance : 0;
+        TestCaseStatistics::printReportRow({key, std::to_string(result.unit), formatNumber(result.mean, 3), SampleGroupsCollector::formatPercent(result.withinDeviation, false),
+                                            SampleGroupsCollector::formatPercent(result.betweenDeviation, false), SampleGroupsCollector::formatPercent(betweenShare, false),
+                                            formatNumber(result.fStatistic, 2), std::to_string(result.processesNeeded)});
+    }
+    std::cout.flush();
+}
+
+RunToRunVariance::Result RunToRunVariance::analyze(MeasurementUnit unit, const std::vector<std::vector<double>> &samplesPerProcess) {
+    const auto anova = SampleStatistics::getOneWayAnova(samplesPerProcess);
+    const double mean = std::abs(anova.grandMean);
+    size_t samplesCount = 0;
+    for (const auto &samples : samplesPerProcess) {
+        samplesCount += samples.size();
+    }
+    const double samplesPerProcessCount = static_cast<double>(samplesCount) / static_cast<double>(samplesPerProcess.size());
+
+    // Variance of the mean of m processes with n samples each is (betweenVariance + withinVariance / n) / m
+    size_t processesNeeded = 1;
+    if (mean > 0) {
+        const double targetHalfWidth = 0.01 * mean / 1.96;
+        const double processMeanVariance = anova.betweenVariance + anova.withinVariance / samplesPerProcessCount;
+        processesNeeded = std::max(size_t{1}, static_cast<size_t>(std::ceil(processMeanVariance / (targetHalfWidth * targetHalfWidth))));
+    }
+
+    Result result{};
+    result.unit = unit;
+    result.mean = anova.grandMean;
+    result.withinDeviation = mean > 0 ? std::sqrt(anova.withinVariance) / mean : 0;
+    result.betweenDeviation = mean > 0 ? std::sqrt(anova.betweenVariance) / mean : 0;
+    result.fStatistic = anova.fStatistic;
+    result.processesNeeded = processesNeeded;
+    return result;
+}
+
+std::map<std::string, RunToRunVariance::Result> &RunToRunVariance::getResults() {
+    static std::map<std::string, Result> results{};
+    return results;
+}
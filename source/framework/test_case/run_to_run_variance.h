@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/enum/measurement_unit.h"
+#include "framework/test_case/test_result.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+class TestCaseStatistics;
+
+// Measures how much results differ between processes, enabled with --repeatProcess. Each configuration is run in the
+// given number of fresh child processes, each of them running --iterations iterations. Samples are grouped by process
+// and a one-way analysis of variance splits their variance into within-process and between-process components. A large
+// between-process component means that state fixed at process start, like memory placement or driver heuristics, moves
+// results and a single process is not representative. The report shows how many processes are needed to measure the
+// mean within 1% with 95% confidence. Each group of results pushed by the test, e.g. time and bandwidth, is analyzed
+// separately.
+class RunToRunVariance {
+  public:
+    struct Result {
+        MeasurementUnit unit;
+        double mean;
+        double withinDeviation;  // relative to the mean
+        double betweenDeviation; // relative to the mean
+        double fStatistic;
+        size_t processesNeeded;
+    };
+
+    static bool isEnabled();
+    static TestResult run(const std::string &testCommandLine, const std::string &testCaseNameWithConfig, const TestCaseStatistics &statistics);
+    static void print();
+
+  private:
+    static Result analyze(MeasurementUnit unit, const std::vector<std::vector<double>> &samplesPerProcess);
+    static std::map<std::string, Result> &getResults();
+};
@@ -49,7 +49,7 @@ class TestCase : public TestCaseBase {
         return implementations[static_cast<int>(api)].function != nullptr;
     }
 
-    bool runFromCommandLine(CommandLineArguments &commandLineArguments) override {
+    bool runFromCommandLine(CommandLineArguments &commandLineArguments, bool printHeader) override {
         // Parse test-specific parameters
         ArgumentContainerT arguments;
         bool error = false;
@@ -75,49 +75,14 @@ class TestCase : public TestCaseBase {
             return false;
         }
 
-        // Try running with all possible APIs. If some are disabled, e.g. --api=ocl is passed, then the rest will be skipped in run() method
-        if (!Configuration::get().noColumnNames) {
-            TestCaseStatistics::printStatisticsHeader(Configuration::get().printType);
-        }
-        for (int apiIndex = static_cast<int>(Api::FIRST); apiIndex <= static_cast<int>(Api::LAST); apiIndex++) {
-            arguments.api = static_cast<Api>(apiIndex);
-            run(arguments);
-        }
-        return true;
+        // Run all points of sweeps with all possible APIs. If some are disabled, e.g. --api=ocl is passed, then the rest will be skipped in run() method
+        return runSweeps(arguments, commandLineArguments, printHeader, [this, &arguments]() { run(arguments); });
     }
 
     void run(ArgumentContainerT arguments) const {
-        // Set iterations count from global configuration
-        if (arguments.iterations != 0) {
-            std::cerr << "WARNING: arguments.iterations was not zero. Overriding with value from global configuration - "
-                      << Configuration::get().iterations << ".\n";
-        }
-        arguments.iterations = Configuration::get().iterations;
-        arguments.noIntelExtensions = Configuration::get().noIntelExtensions;
-
-        // Create statistics object
-        const auto testCaseNameWithConfig = getTestCaseNameWithConfig(arguments, Configuration::get().dumpCommandLines);
-        TestCaseStatistics statistics{arguments.iterations, Configuration::get().printType};
-
-        // Run test
-        const auto testResult = runImpl(statistics, arguments, testCaseNameWithConfig);
-        if (testResult == TestResult::Success) {
-            DEVELOPER_WARNING_IF(!statistics.isFull(), "test did not generate as many values as expected");
-            statistics.printStatistics(testCaseNameWithConfig);
-        } else if (testResult == TestResult::Nooped) {
-            statistics.printStatistics(testCaseNameWithConfig);
-        } else {
-            const auto &testResultInfo = TestResultHelper::getTestResultInfo(testResult);
-
-            // If test was skipped at the very beginning, it shouldn't have pushed any statistics
-            DEVELOPER_WARNING_IF(testResultInfo.wasTestSkipped && !statistics.isEmpty(), "test was skipped but generated some values");
-
-            // Print output line with error info if needed
-            const auto printMessage = arguments.isSingleTestMode ? testResultInfo.printInSingleTestMode : testResultInfo.printInAllTestsMode;
-            if (printMessage) {
-                statistics.printStatisticsString(testCaseNameWithConfig, testResultInfo.stringMessage);
-            }
-        }
+        runConfiguration(arguments, [this, &arguments](TestCaseStatistics &statistics, const std::string &testCaseNameWithConfig) {
+            return runImpl(statistics, arguments, testCaseNameWithConfig);
+        });
     }
 
   private:
@@ -168,16 +133,6 @@ class TestCase : public TestCaseBase {
         }
 
         // Run the test
-        if (Configuration::get().interactivePrints) {
-            // This will print test name before running the actual test along with '\r' character,
-            // so it will be overwritten in next step.
-            statistics.printStatisticsBeforeTest(testCaseNameWithConfig);
-        }
-        const TestResult testResult = benchmarkImplementation.function(arguments, statistics);
-        if (Configuration::get().interactivePrints) {
-            // This will overwrite the test name, because it was only a temporal caption.
-            statistics.printClearLineAfterTest();
-        }
-        return testResult;
+        return runTestInSelectedMode(statistics, arguments, testCaseNameWithConfig, [&]() { return benchmarkImplementation.function(arguments, statistics); });
     }
 };
@@ -7,9 +7,31 @@
 
 #include "test_case_base.h"
 
+#include "framework/argument/basic_argument.h"
 #include "framework/benchmark_info.h"
 #include "framework/configuration.h"
+#include "framework/supported_apis.h"
+#include "framework/test_case/ab_comparison.h"
+#include "framework/test_case/api_comparison_report.h"
+#include "framework/test_case/autotuner.h"
+#include "framework/test_case/checkpoint.h"
+#include "framework/test_case/configuration_durations.h"
+#include "framework/test_case/execution_order.h"
+#include "framework/test_case/isolated_test_runner.h"
+#include "framework/test_case/run_to_run_variance.h"
 #include "framework/test_case/test_case_argument_container.h"
+#include "framework/test_case/test_case_statistics.h"
+#include "framework/test_case/test_plan.h"
+#include "framework/utility/api_call_tracer_helper.h"
+#include "framework/utility/error.h"
+#include "framework/utility/instrumentation_plugins.h"
+#include "framework/utility/trace_recorder.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <memory>
 
 bool TestCaseBase::parseArguments(TestCaseArgumentContainer &arguments, CommandLineArguments &commandLineArguments) {
     arguments.isSingleTestMode = true;
@@ -21,6 +43,61 @@ bool TestCaseBase::parseArguments(TestCaseArgumentContainer &arguments, CommandL
     return true;
 }
 
+bool TestCaseBase::expandSweeps(TestCaseArgumentContainer &arguments, const CommandLineArguments &commandLineArguments, std::vector<ArgumentSweep> &outSweeps) {
+    outSweeps.clear();
+    for (Argument *argument : arguments.getArguments()) {
+        // Last occurrence of the argument is used, the same as in parseArguments()
+        const CommandLineArgument *commandLineArgument = nullptr;
+        for (const auto &candidate : commandLineArguments) {
+            if (candidate.isKeyEqualTo(argument->getKey())) {
+                commandLineArgument = &candidate;
+            }
+        }
+        if (commandLineArgument == nullptr) {
+            continue;
+        }
+
+        std::vector<std::string> values{};
+        if (!argument->expandSweep(commandLineArgument->getValue(), values)) {
+            std::cerr << "Invalid sweep for argument " << argument->getKey() << ": " << commandLineArgument->getValue() << std::endl;
+            return false;
+        }
+        if (values.size() > 1) {
+            outSweeps.push_back({argument, std::move(values)});
+        } else if (values[0] != commandLineArgument->getValue()) {
+            argument->parseValue(values[0]);
+        }
+    }
+
+    const auto isBufferSize = [](const ArgumentSweep &sweep) { return dynamic_cast<const ByteSizeArgument *>(sweep.argument) != nullptr; };
+    std::stable_partition(outSweeps.begin(), outSweeps.end(), isBufferSize);
+
+    const size_t maxPointsCount = 100000u;
+    if (getSweepPointsCount(outSweeps) > maxPointsCount) {
+        std::cerr << "Sweep has too many points, maximum is " << maxPointsCount << std::endl;
+        return false;
+    }
+    return true;
+}
+
+size_t TestCaseBase::getSweepPointsCount(const std::vector<ArgumentSweep> &sweeps) {
+    size_t pointsCount = 1u;
+    for (const auto &sweep : sweeps) {
+        if (pointsCount > std::numeric_limits<size_t>::max() / sweep.values.size()) {
+            return std::numeric_limits<size_t>::max();
+        }
+        pointsCount *= sweep.values.size();
+    }
+    return pointsCount;
+}
+
+void TestCaseBase::applySweepPoint(const std::vector<ArgumentSweep> &sweeps, size_t pointIndex) {
+    for (auto sweep = sweeps.rbegin(); sweep != sweeps.rend(); sweep++) {
+        sweep->argument->parseValue(sweep->values[pointIndex % sweep->values.size()]);
+        pointIndex /= sweep->values.size();
+    }
+}
+
 std::vector<Api> TestCaseBase::getApisWithImplementation() const {
     std::vector<Api> apis = {};
     for (int apiIndex = static_cast<int>(Api::FIRST); apiIndex <= static_cast<int>(Api::LAST); apiIndex++) {
@@ -32,6 +109,169 @@ std::vector<Api> TestCaseBase::getApisWithImplementation() const {
     return apis;
 }
 
+bool TestCaseBase::runSweeps(TestCaseArgumentContainer &arguments, const CommandLineArguments &commandLineArguments, bool printHeader, const std::function<void()> &runCurrentConfiguration) const {
+    if (Autotuner::isEnabled() && !Autotuner::isTunable(arguments)) {
+        std::cerr << "Test " << getTestCaseName() << " cannot be autotuned, it has no --wgs and --wgc arguments" << std::endl;
+        return false;
+    }
+    if (Autotuner::isEnabled() && getAutotuneObjective() == Autotuner::Objective::None) {
+        std::cerr << "Test " << getTestCaseName() << " cannot be autotuned, its result does not depend on work done by the kernel" << std::endl;
+        return false;
+    }
+
+    // Expand sweeps, e.g. --size=4KB:1GB:*2 --wgs=32,64,256, into points with a single value for each argument
+    std::vector<ArgumentSweep> sweeps{};
+    if (!expandSweeps(arguments, commandLineArguments, sweeps)) {
+        return false;
+    }
+
+    if (printHeader && !Configuration::get().noColumnNames) {
+        TestCaseStatistics::printStatisticsHeader(Configuration::get().printType);
+    }
+
+    // In single-test mode points of the sweep are all configurations of the run, so they are shuffled and run in
+    // rounds here. Test plans order their lines themselves.
+    const bool ordersConfigurations = printHeader;
+    std::vector<size_t> sweepPoints(getSweepPointsCount(sweeps));
+    for (size_t sweepPointIndex = 0u; sweepPointIndex < sweepPoints.size(); sweepPointIndex++) {
+        sweepPoints[sweepPointIndex] = sweepPointIndex;
+    }
+    const size_t roundsCount = ordersConfigurations ? ExecutionOrder::getRoundsCount() : 1;
+    for (size_t round = 0; round < roundsCount; round++) {
+        if (ordersConfigurations) {
+            ExecutionOrder::beginRound(round);
+        }
+        if (ordersConfigurations && ExecutionOrder::isShuffleEnabled()) {
+            ExecutionOrder::shuffle(sweepPoints, round);
+        }
+        for (const size_t sweepPointIndex : sweepPoints) {
+            applySweepPoint(sweeps, sweepPointIndex);
+            for (int apiIndex = static_cast<int>(Api::FIRST); apiIndex <= static_cast<int>(Api::LAST); apiIndex++) {
+                arguments.api = static_cast<Api>(apiIndex);
+                if (Autotuner::isEnabled()) {
+                    autotune(arguments, runCurrentConfiguration);
+                } else {
+                    runCurrentConfiguration();
+                }
+            }
+        }
+    }
+    return true;
+}
+
+// Every evaluation of the search is a regular run, APIs which would be skipped are not searched
+void TestCaseBase::autotune(TestCaseArgumentContainer &arguments, const std::function<void()> &runCurrentConfiguration) const {
+    const auto selectedApi = Configuration::get().selectedApi;
+    if (arguments.api != selectedApi && selectedApi != Api::All) {
+        return;
+    }
+    if (!SupportedApis::isApiSupported(arguments.api) || !isApiImplemented(arguments.api)) {
+        runCurrentConfiguration();
+        return;
+    }
+    Autotuner::tune(arguments, getAutotuneObjective(), runCurrentConfiguration);
+}
+
+void TestCaseBase::runConfiguration(TestCaseArgumentContainer &arguments, const RunTestFunction &runTest) const {
+    // Set iterations count from global configuration
+    if (arguments.iterations != 0) {
+        std::cerr << "WARNING: arguments.iterations was not zero. Overriding with value from global configuration - "
+                  << Configuration::get().iterations << ".\n";
+    }
+    arguments.iterations = ExecutionOrder::isRoundRobinEnabled() ? ExecutionOrder::getRoundIterations() : Configuration::get().iterations;
+    arguments.noIntelExtensions = Configuration::get().noIntelExtensions;
+
+    // Configurations completed before the run was interrupted are not run again
+    const auto checkpointKey = Checkpoint::isEnabled() ? getTestCaseNameWithConfig(arguments, true) : std::string{};
+    if (Checkpoint::isEnabled() && Checkpoint::get().printCompleted(checkpointKey)) {
+        return;
+    }
+    if (Checkpoint::isEnabled()) {
+        Checkpoint::get().beginRecording();
+    }
+
+    // Create statistics object. With --roundRobin samples of all rounds go to the same statistics.
+    const auto testCaseNameWithConfig = getTestCaseNameWithConfig(arguments, Configuration::get().dumpCommandLines);
+    if (ExecutionOrder::isRoundRobinEnabled() && !ExecutionOrder::beginConfiguration(testCaseNameWithConfig)) {
+        return;
+    }
+    std::unique_ptr<TestCaseStatistics> ownStatistics{};
+    if (!ExecutionOrder::isRoundRobinEnabled()) {
+        ownStatistics = std::make_unique<TestCaseStatistics>(arguments.iterations, Configuration::get().printType);
+    }
+    TestCaseStatistics &statistics = ownStatistics ? *ownStatistics : ExecutionOrder::getStatistics(testCaseNameWithConfig);
+
+    // Run test
+    const auto testStartTime = std::chrono::steady_clock::now();
+    statistics.recordMemoryFootprintBeforeTest();
+    const auto testResult = runTest(statistics, testCaseNameWithConfig);
+    statistics.recordMemoryFootprintAfterTest();
+    const bool wasRun = testResult != TestResult::SkippedApi && testResult != TestResult::UnsupportedApi && testResult != TestResult::NoImplementation && testResult != TestResult::FilteredOut;
+    if (ConfigurationDurations::isEnabled() && wasRun) {
+        const std::chrono::duration<double> testDuration = std::chrono::steady_clock::now() - testStartTime;
+        ConfigurationDurations::get().record(getTestCaseNameWithConfig(arguments, true), testDuration.count(), static_cast<size_t>(arguments.iterations));
+    }
+    if (IsolatedTestRunner::isChildProcess()) {
+        IsolatedTestRunner::setChildResult(arguments.api, testResult);
+    }
+    if (IsolatedTestRunner::isSamplesChildProcess() && testResult == TestResult::Success) {
+        statistics.writeSamplesToParentProcess();
+    }
+
+    // Results of a round-robin run are reported after its last round, or after the round in which it failed
+    if (ExecutionOrder::isRoundRobinEnabled() && testResult == TestResult::Success && !ExecutionOrder::isLastRound()) {
+        return;
+    }
+
+    const ResultReporter resultReporter = getResultReporter(testResult);
+    if (resultReporter == ResultReporter::ThisProcess) {
+        reportResult(statistics, arguments, testCaseNameWithConfig, testResult);
+    } else if (resultReporter == ResultReporter::ChildProcess && ApiComparisonReport::isEnabled()) {
+        // Child process prints the result, but reports spanning all configurations are printed by this process
+        statistics.addToApiComparisonReport(getTestCaseName(), arguments.getCurrentConfig(false), arguments.api);
+    }
+    if (ExecutionOrder::isRoundRobinEnabled()) {
+        ExecutionOrder::setFinished(testCaseNameWithConfig);
+    }
+    if (Checkpoint::isEnabled()) {
+        Checkpoint::get().endRecording(checkpointKey, testResult);
+    }
+    TraceRecorder::flush();
+}
+
+TestResult TestCaseBase::runTestInSelectedMode(TestCaseStatistics &statistics, const TestCaseArgumentContainer &arguments, const std::string &testCaseNameWithConfig,
+                                               const std::function<TestResult()> &runTestInThisProcess) const {
+    if (Configuration::get().interactivePrints) {
+        // This will print test name before running the actual test along with '\r' character,
+        // so it will be overwritten in next step.
+        statistics.printStatisticsBeforeTest(testCaseNameWithConfig);
+    }
+    TestResult testResult{};
+    {
+        TraceScope traceScope{testCaseNameWithConfig, "test"};
+        if (AbComparison::isEnabled()) {
+            testResult = AbComparison::run(getTestCaseNameWithConfig(arguments, true), testCaseNameWithConfig, statistics);
+        } else if (RunToRunVariance::isEnabled()) {
+            testResult = RunToRunVariance::run(getTestCaseNameWithConfig(arguments, true), testCaseNameWithConfig, statistics);
+        } else if (IsolatedTestRunner::isEnabled()) {
+            IsolatedTestRunner::SampleGroups groups{};
+            testResult = IsolatedTestRunner::run(getTestCaseNameWithConfig(arguments, true), ApiComparisonReport::isEnabled() ? &groups : nullptr);
+            statistics.addSamplesFromChildProcess(groups);
+        } else {
+            ApiCallTracerHelper::notifyTestBegin(testCaseNameWithConfig);
+            InstrumentationPlugins::notifyTestBegin(testCaseNameWithConfig);
+            testResult = runTestInThisProcess();
+            InstrumentationPlugins::notifyTestEnd(testCaseNameWithConfig, testResult == TestResult::Success);
+            ApiCallTracerHelper::notifyTestEnd();
+        }
+    }
+    if (Configuration::get().interactivePrints) {
+        // This will overwrite the test name, because it was only a temporal caption.
+        statistics.printClearLineAfterTest();
+    }
+    return testResult;
+}
+
 std::string TestCaseBase::getTestCaseNameWithConfig(const TestCaseArgumentContainer &arguments, bool commandLine) const {
     std::ostringstream result{};
 
@@ -53,6 +293,56 @@ std::string TestCaseBase::getTestCaseNameWithConfig(const TestCaseArgumentContai
     return result.str();
 }
 
+TestCaseBase::ResultReporter TestCaseBase::getResultReporter(TestResult testResult) {
+    if (IsolatedTestRunner::isChildProcess()) {
+        const bool printsResult = testResult == TestResult::Success && !IsolatedTestRunner::isSamplesOnlyChildProcess();
+        return printsResult ? ResultReporter::ThisProcess : ResultReporter::ParentProcess;
+    }
+    if (testResult != TestResult::Success) {
+        return ResultReporter::ThisProcess;
+    }
+    if (AbComparison::isEnabled() || RunToRunVariance::isEnabled()) {
+        return ResultReporter::Analysis;
+    }
+    if (IsolatedTestRunner::isEnabled()) {
+        return ResultReporter::ChildProcess;
+    }
+    return ResultReporter::ThisProcess;
+}
+
+void TestCaseBase::reportResult(TestCaseStatistics &statistics, const TestCaseArgumentContainer &arguments, const std::string &testCaseNameWithConfig, TestResult testResult) const {
+    if (testResult == TestResult::Success) {
+        DEVELOPER_WARNING_IF(!statistics.isFull(), "test did not generate as many values as expected");
+        statistics.printStatistics(testCaseNameWithConfig);
+        statistics.writeSampleDump(testCaseNameWithConfig);
+        statistics.appendToHistory(testCaseNameWithConfig);
+        if (ApiComparisonReport::isEnabled()) {
+            statistics.addToApiComparisonReport(getTestCaseName(), arguments.getCurrentConfig(false), arguments.api);
+        }
+        if (Autotuner::isEnabled()) {
+            statistics.addToAutotuner(testCaseNameWithConfig);
+        }
+    } else if (testResult == TestResult::Nooped) {
+        if (!TestPlan::isCollecting()) {
+            statistics.printStatistics(testCaseNameWithConfig);
+        }
+        if (TestPlan::isExportEnabled()) {
+            TestPlan::exportConfiguration(getTestCaseNameWithConfig(arguments, true), getTestCaseNameWithConfig(arguments, false));
+        }
+    } else {
+        const auto &testResultInfo = TestResultHelper::getTestResultInfo(testResult);
+
+        // If test was skipped at the very beginning, it shouldn't have pushed any statistics
+        DEVELOPER_WARNING_IF(testResultInfo.wasTestSkipped && !statistics.isEmpty(), "test was skipped but generated some values");
+
+        // Print output line with error info if needed
+        const auto printMessage = arguments.isSingleTestMode ? testResultInfo.printInSingleTestMode : testResultInfo.printInAllTestsMode;
+        if (printMessage) {
+            statistics.printStatisticsString(testCaseNameWithConfig, testResultInfo.stringMessage);
+        }
+    }
+}
+
 bool TestCaseBase::matchesWithTestFilter() const {
     for (const std::string &testFilter : Configuration::get().testFilter.get()) {
         const auto testCaseName = getTestCaseName();
@@ -8,18 +8,63 @@
 #pragma once
 
 #include "framework/enum/api.h"
+#include "framework/test_case/autotuner.h"
 #include "framework/test_case/test_case_interface.h"
+#include "framework/test_case/test_result.h"
 
+#include <functional>
+#include <string>
+#include <vector>
+
+struct Argument;
 struct TestCaseArgumentContainer;
+class TestCaseStatistics;
 
 // This class implements test-agnostic functionality of the TestCase class. All methods, which do not require
 // a concrete TestCaseArgument class for a specific test should be placed in this class as a protected method.
 class TestCaseBase : public TestCaseInterface {
+  public:
+    // Tests which can be autotuned with --autotune declare how their result depends on the launch
+    virtual Autotuner::Objective getAutotuneObjective() const { return Autotuner::Objective::None; }
+
   protected:
     static bool parseArguments(TestCaseArgumentContainer &arguments, CommandLineArguments &commandLineArguments);
+
+    // Sweeps of single-test mode, e.g. --size=4KB:1GB:*2. Points are all combinations of swept values, numbered so the
+    // last sweep changes fastest. Buffer size sweeps are moved to the front, so consecutive points allocate buffers of
+    // the same size.
+    struct ArgumentSweep {
+        Argument *argument;
+        std::vector<std::string> values;
+    };
+    static bool expandSweeps(TestCaseArgumentContainer &arguments, const CommandLineArguments &commandLineArguments, std::vector<ArgumentSweep> &outSweeps);
+    static size_t getSweepPointsCount(const std::vector<ArgumentSweep> &sweeps);
+    static void applySweepPoint(const std::vector<ArgumentSweep> &sweeps, size_t pointIndex);
     std::vector<Api> getApisWithImplementation() const override;
+
+    // Runs all points of sweeps with all APIs, in rounds and order selected by global configuration, or autotunes them
+    bool runSweeps(TestCaseArgumentContainer &arguments, const CommandLineArguments &commandLineArguments, bool printHeader, const std::function<void()> &runCurrentConfiguration) const;
+    void autotune(TestCaseArgumentContainer &arguments, const std::function<void()> &runCurrentConfiguration) const;
+
+    // Runs a single configuration and reports its result. Checks and the test itself are done by runTest, which calls
+    // runTestInSelectedMode() to run the test in this process, in a child process or in an A/B comparison.
+    using RunTestFunction = std::function<TestResult(TestCaseStatistics &statistics, const std::string &testCaseNameWithConfig)>;
+    void runConfiguration(TestCaseArgumentContainer &arguments, const RunTestFunction &runTest) const;
+    TestResult runTestInSelectedMode(TestCaseStatistics &statistics, const TestCaseArgumentContainer &arguments, const std::string &testCaseNameWithConfig,
+                                     const std::function<TestResult()> &runTestInThisProcess) const;
+
     std::string getTestCaseNameWithConfig(const TestCaseArgumentContainer &arguments, bool commandLine) const;
 
+    // Process which prints and records the result of a configuration
+    enum class ResultReporter {
+        ThisProcess,
+        ChildProcess,  // successful results of --isolate are printed by the child, its samples feed reports of the parent
+        ParentProcess, // failures of children and all results of children passing only samples are reported by the parent
+        Analysis,      // A/B comparison and --repeatProcess print their analysis instead of the result
+    };
+    static ResultReporter getResultReporter(TestResult testResult);
+    void reportResult(TestCaseStatistics &statistics, const TestCaseArgumentContainer &arguments, const std::string &testCaseNameWithConfig, TestResult testResult) const;
+
     // Filters
     bool matchesWithTestFilter() const;
     bool matchesWithArgFilter(const ArgumentContainer &arguments) const;
@@ -16,7 +16,7 @@ struct ArgumentContainer;
 
 struct TestCaseInterface {
     virtual ~TestCaseInterface() = default;
-    virtual bool runFromCommandLine(CommandLineArguments &commandLineArguments) = 0;
+    virtual bool runFromCommandLine(CommandLineArguments &commandLineArguments, bool printHeader) = 0;
     virtual bool isApiImplemented(Api api) const = 0;
     virtual std::vector<Api> getApisWithImplementation() const = 0;
     virtual std::unique_ptr<ArgumentContainer> getArguments() const = 0;
@@ -8,7 +8,12 @@
 #include "test_case_statistics.h"
 
 #include "framework/benchmark_info.h"
+#include "framework/test_case/api_comparison_report.h"
+#include "framework/test_case/autotuner.h"
+#include "framework/test_case/isolated_test_runner.h"
 #include "framework/utility/error.h"
+#include "framework/utility/instrumentation_plugins.h"
+#include "framework/utility/result_history.h"
 
 #include <algorithm>
 #include <array>
@@ -20,7 +25,18 @@
 
 TestCaseStatistics::TestCaseStatistics(size_t maxSamplesCount, Configuration::PrintType printType)
     : Statistics(maxSamplesCount),
-      printType(printType) {
+      printType(printType),
+      energyEnabled(printType != Configuration::PrintType::Noop && EnergyMeter::isEnabled()),
+      pluginsEnabled(printType != Configuration::PrintType::Noop && InstrumentationPlugins::isAnyLoaded()),
+      sampleDumpEnabled(printType != Configuration::PrintType::Noop && !static_cast<const std::string &>(Configuration::get().dumpSamples).empty()),
+      sampleDumpStart(Clock::now()) {
+    if (energyEnabled) {
+        energyCounters = EnergyMeter::readCounters();
+    }
+    if (sampleDumpEnabled) {
+        const auto sinceEpoch = std::chrono::system_clock::now().time_since_epoch();
+        sampleDump.startTimeUnixNanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(sinceEpoch).count();
+    }
 }
 
 void TestCaseStatistics::pushValue(Clock::duration time, MeasurementUnit unit, MeasurementType type, const std::string &description) {
@@ -50,6 +66,11 @@ void TestCaseStatistics::pushValue(Clock::duration time, MeasurementUnit unit, M
     default:
         FATAL_ERROR("Unknown measurement unit");
     }
+
+    if (description.empty()) {
+        pushEnergyValues(timeSeconds, 0);
+    }
+    pushPluginValues(description);
 }
 
 void TestCaseStatistics::pushValue(Clock::duration time, uint64_t size, MeasurementUnit unit, MeasurementType type, const std::string &description) {
@@ -58,6 +79,7 @@ void TestCaseStatistics::pushValue(Clock::duration time, uint64_t size, Measurem
 
     overrideMeasurementUnit(unit);
 
+    Value bandwidth = 0;
     switch (unit) {
     case MeasurementUnit::Microseconds: {
         const Value timeMicroseconds = timeSeconds * 1e6;
@@ -66,13 +88,18 @@ void TestCaseStatistics::pushValue(Clock::duration time, uint64_t size, Measurem
     }
     case MeasurementUnit::GigabytesPerSecond: {
         const Value sizeInGigabytes = size / (1024 * 1024 * 1024.0);
-        const Value bandwidth = sizeInGigabytes / timeSeconds;
+        bandwidth = sizeInGigabytes / timeSeconds;
         this->pushValue(bandwidth, description, unit, type);
         break;
     }
     default:
         FATAL_ERROR("Unknown measurement unit");
     }
+
+    if (description.empty()) {
+        pushEnergyValues(timeSeconds, bandwidth);
+    }
+    pushPluginValues(description);
 }
 
 void TestCaseStatistics::pushUnitAndType(MeasurementUnit unit, MeasurementType type) {
@@ -101,6 +128,111 @@ bool TestCaseStatistics::isFull() const {
     return true;
 }
 
+void TestCaseStatistics::recordMemoryFootprintBeforeTest() {
+    if (printType != Configuration::PrintType::DefaultWithVerbose) {
+        return;
+    }
+    MemoryFootprint::resetPeakResident();
+    memoryFootprintBeforeTest = MemoryFootprint::capture();
+}
+
+void TestCaseStatistics::recordMemoryFootprintAfterTest() {
+    if (printType != Configuration::PrintType::DefaultWithVerbose) {
+        return;
+    }
+    memoryFootprintAfterTest = MemoryFootprint::capture();
+    memoryFootprintRecorded = true;
+}
+
+void TestCaseStatistics::writeSampleDump(const std::string &testCaseName) {
+    if (!sampleDumpEnabled) {
+        return;
+    }
+
+    sampleDump.testCaseName = testCaseName;
+    sampleDump.channels.resize(sampleDumpChannelIds.size());
+    for (const auto &[description, channelId] : sampleDumpChannelIds) {
+        const Samples &samples = samplesMap.at(description);
+        sampleDump.channels[channelId] = {MetricsStrings::generateLabel(description, samples.unit), std::to_string(samples.type)};
+    }
+
+    const std::string filePath = SampleDump::getFilePath(Configuration::get().dumpSamples, testCaseName);
+    if (!sampleDump.writeToFile(filePath)) {
+        printMessageLine("WARNING", "Could not write samples to " + filePath);
+    }
+}
+
+void TestCaseStatistics::appendToHistory(const std::string &testCaseName) const {
+    const std::string &historyFile = Configuration::get().history;
+    if (historyFile.empty() || printType == Configuration::PrintType::Noop) {
+        return;
+    }
+
+    const auto now = std::chrono::system_clock::now().time_since_epoch();
+    const std::string version = BenchmarkInfo::get().getBenchmarkVersion();
+    std::vector<ResultHistoryEntry> entries{};
+    for (const auto &[name, samples] : samplesMap) {
+        const Metrics metrics{samples.vector};
+        ResultHistoryEntry entry{};
+        entry.unixTimeSeconds = std::chrono::duration_cast<std::chrono::seconds>(now).count();
+        entry.benchmarkName = BenchmarkInfo::get().getBenchmarkName();
+        entry.benchmarkVersion = version.empty() ? "unknown" : version;
+        entry.configuration = testCaseName;
+        entry.label = MetricsStrings::generateLabel(name, samples.unit);
+        entry.type = std::to_string(samples.type);
+        entry.mean = metrics.mean;
+        entry.median = metrics.median;
+        entry.relativeStandardDeviation = metrics.standardDeviation;
+        entry.min = metrics.min;
+        entry.max = metrics.max;
+        entry.samplesCount = samples.vector.size();
+        entries.push_back(std::move(entry));
+    }
+
+    if (!ResultHistory::append(historyFile, entries)) {
+        printMessageLine("WARNING", "Could not append results to " + historyFile);
+    }
+}
+
+void TestCaseStatistics::addToApiComparisonReport(const std::string &testCaseName, const std::string &config, Api api) const {
+    const auto samplesIt = samplesMap.find("");
+    if (samplesIt == samplesMap.end() || samplesIt->second.vector.empty()) {
+        return;
+    }
+
+    const Samples &samples = samplesIt->second;
+    const Metrics metrics{samples.vector};
+    const Value standardError = metrics.standardDeviation * metrics.mean / std::sqrt(static_cast<Value>(samples.vector.size()));
+    ApiComparisonReport::addResult(testCaseName, config, api, {metrics.mean, std::abs(standardError), samples.unit});
+}
+
+void TestCaseStatistics::addToAutotuner(const std::string &testCaseName) const {
+    const auto samplesIt = samplesMap.find("");
+    if (samplesIt == samplesMap.end() || samplesIt->second.vector.empty()) {
+        return;
+    }
+    Autotuner::addResult(testCaseName, Metrics{samplesIt->second.vector}.mean, samplesIt->second.unit);
+}
+
+void TestCaseStatistics::writeSamplesToParentProcess() const {
+    IsolatedTestRunner::SampleGroups groups{};
+    for (const auto &[description, samples] : samplesMap) {
+        if (!samples.vector.empty()) {
+            groups.push_back({description, samples.unit, samples.vector});
+        }
+    }
+    IsolatedTestRunner::writeSamples(groups);
+}
+
+// Samples are only used by reports of the parent process, they are not counted towards the expected number of samples
+void TestCaseStatistics::addSamplesFromChildProcess(const IsolatedTestRunner::SampleGroups &groups) {
+    for (const auto &group : groups) {
+        Samples &samples = samplesMap[group.description];
+        samples.unit = group.unit;
+        samples.vector = group.samples;
+    }
+}
+
 void TestCaseStatistics::overrideMeasurementUnit(MeasurementUnit &unit) {
     if (unit == MeasurementUnit::GigabytesPerSecond && Configuration::get().doNotPrintBandwidth) {
         unit = MeasurementUnit::Microseconds;
@@ -130,6 +262,51 @@ void TestCaseStatistics::pushValue(Value value, const std::string &description,
     if (std::isinf(value)) {
         this->reachedInfinity = true;
     }
+
+    if (sampleDumpEnabled) {
+        const auto channelId = sampleDumpChannelIds.emplace(description, static_cast<uint32_t>(sampleDumpChannelIds.size())).first->second;
+        const auto timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - sampleDumpStart);
+        sampleDump.timestamps.push_back(timestamp.count());
+        sampleDump.values.push_back(value);
+        sampleDump.channelIds.push_back(channelId);
+    }
+}
+
+void TestCaseStatistics::pushEnergyValues(Value timeSeconds, Value bandwidth) {
+    if (!energyEnabled) {
+        return;
+    }
+
+    // RAPL counters are updated roughly every millisecond, so iterations shorter than that may report no energy
+    const EnergyMeter::Energy energy = EnergyMeter::takeIterationEnergy(energyCounters);
+    const auto &domains = EnergyMeter::getDomains();
+    for (auto domainIndex = 0u; domainIndex < domains.size(); domainIndex++) {
+        const Value joules = energy[domainIndex];
+        this->pushValue(joules * 1e3, domains[domainIndex].name + " energy", MeasurementUnit::Millijoules, MeasurementType::Cpu);
+        if (bandwidth > 0) {
+            const Value watts = joules / timeSeconds;
+            const Value bandwidthPerWatt = watts > 0 ? bandwidth / watts : 0;
+            this->pushValue(bandwidthPerWatt, domains[domainIndex].name + " efficiency", MeasurementUnit::GigabytesPerSecondPerWatt, MeasurementType::Cpu);
+        }
+    }
+}
+
+void TestCaseStatistics::pushPluginValues(const std::string &description) {
+    if (!pluginsEnabled) {
+        return;
+    }
+
+    // Plugins may contribute their own values only along with the main result, so that each group gets
+    // exactly one value per iteration
+    const Samples &samples = samplesMap.at(description);
+    const ComputeBenchmarksSampleSink sink{this, &TestCaseStatistics::pushPluginSample};
+    InstrumentationPlugins::notifySamplePush(description, std::to_string(samples.unit), samples.vector.back(), description.empty() ? &sink : nullptr);
+}
+
+void TestCaseStatistics::pushPluginSample(void *context, const char *groupName, const char *unitLabel, double value) {
+    auto statistics = static_cast<TestCaseStatistics *>(context);
+    const std::string description = std::string(groupName) + " [" + unitLabel + "]";
+    statistics->pushValue(value, description, MeasurementUnit::Custom, MeasurementType::Cpu);
 }
 
 struct ColumnInfo {
@@ -179,6 +356,26 @@ void TestCaseStatistics::printStatisticsHeader(Configuration::PrintType printTyp
     }
 }
 
+// Rows of reports printed after all tests, e.g. --compareApis. First cell is the test case name and it is aligned with
+// results of tests. Last cell holds notes of variable length, so it is left-aligned.
+void TestCaseStatistics::printReportRow(const std::initializer_list<std::string> &cells) {
+    auto cell = cells.begin();
+    if (Configuration::get().printType == Configuration::PrintType::Csv) {
+        std::cout << *cell++;
+        while (cell != cells.end()) {
+            std::cout << ',' << *cell++;
+        }
+    } else {
+        const auto lastCell = cells.end() - 1;
+        std::cout << std::setw(BenchmarkInfo::get().getTestCaseNameColumnWidth()) << *cell++;
+        while (cell != lastCell) {
+            std::cout << std::setw(15) << *cell++;
+        }
+        std::cout << "  " << *lastCell;
+    }
+    std::cout << '\n';
+}
+
 void TestCaseStatistics::printStatisticsBeforeTest(const std::string &testCaseName) const {
     // Ending line with carriage return instead of newline will cause the next print to overwrite this line
     printStatisticsString(testCaseName, "", '\r');
@@ -281,9 +478,25 @@ void TestCaseStatistics::printStatisticsVerbose() const {
         }
         std::cout << "]\n";
     }
+    printMemoryFootprint();
     std::cout << '\n';
 }
 
+void TestCaseStatistics::printMemoryFootprint() const {
+    if (!memoryFootprintRecorded) {
+        return;
+    }
+
+    const MemoryFootprint &before = memoryFootprintBeforeTest;
+    const MemoryFootprint &after = memoryFootprintAfterTest;
+    std::cout << "memory footprint: "
+              << "peak RSS delta " << std::max<int64_t>(after.peakResidentKilobytes - before.residentKilobytes, 0) << " kB, "
+              << "RSS growth " << after.residentKilobytes - before.residentKilobytes << " kB, "
+              << "anonymous memory growth " << after.anonymousKilobytes - before.anonymousKilobytes << " kB, "
+              << "minor page faults " << after.minorPageFaults - before.minorPageFaults << ", "
+              << "major page faults " << after.majorPageFaults - before.majorPageFaults << '\n';
+}
+
 void TestCaseStatistics::printStatisticsString(const std::string &testCaseName, const std::string &message, char lineEnding) const {
     const auto columns = ColumnInfo::getColumns();
     const auto columnCount = ColumnInfo::getColumnCount();
@@ -407,6 +620,9 @@ std::string TestCaseStatistics::MetricsStrings::generate(Value value) {
 }
 
 std::string TestCaseStatistics::MetricsStrings::generateLabel(const std::string &name, MeasurementUnit unit) {
+    if (unit == MeasurementUnit::Custom) {
+        return name;
+    }
     if (name.empty()) {
         return std::to_string(unit);
     }
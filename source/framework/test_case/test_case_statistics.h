@@ -7,8 +7,15 @@
 
 #pragma once
 #include "framework/configuration.h"
+#include "framework/enum/api.h"
+#include "framework/test_case/isolated_test_runner.h"
+#include "framework/utility/energy_meter.h"
+#include "framework/utility/instrumentation_plugin_interface.h"
+#include "framework/utility/memory_footprint.h"
+#include "framework/utility/sample_dump_writer.h"
 #include "framework/utility/statistics.h"
 
+#include <initializer_list>
 #include <map>
 #include <memory>
 #include <string>
@@ -34,7 +41,17 @@ class TestCaseStatistics : public Statistics {
     bool isEmpty() const override;
     bool isFull() const override;
 
+    void recordMemoryFootprintBeforeTest();
+    void recordMemoryFootprintAfterTest();
+    void writeSampleDump(const std::string &testCaseName);
+    void appendToHistory(const std::string &testCaseName) const;
+    void addToApiComparisonReport(const std::string &testCaseName, const std::string &config, Api api) const;
+    void addToAutotuner(const std::string &testCaseName) const;
+    void writeSamplesToParentProcess() const;
+    void addSamplesFromChildProcess(const IsolatedTestRunner::SampleGroups &groups);
+
     static void printStatisticsHeader(Configuration::PrintType printType);
+    static void printReportRow(const std::initializer_list<std::string> &cells);
     void printStatisticsBeforeTest(const std::string &testCaseName) const;
     void printClearLineAfterTest() const;
     void printStatistics(const std::string &testCaseName) const;
@@ -43,15 +60,29 @@ class TestCaseStatistics : public Statistics {
   private:
     static void overrideMeasurementUnit(MeasurementUnit &unit);
     void pushValue(Value value, const std::string &description, MeasurementUnit unit, MeasurementType type);
+    void pushEnergyValues(Value timeSeconds, Value bandwidth);
+    void pushPluginValues(const std::string &description);
+    static void pushPluginSample(void *context, const char *groupName, const char *unitLabel, double value);
     void printStatisticsDefault(const std::string &testCaseName) const;
     void printStatisticsNoop(const std::string &testCaseName) const;
     void printStatisticsCsv(const std::string &testCaseName) const;
     void printStatisticsVerbose() const;
+    void printMemoryFootprint() const;
 
     const Configuration::PrintType printType;
     SamplesMap samplesMap = {};
     Samples noopSample = {};
     bool reachedInfinity = false;
+    const bool energyEnabled;
+    EnergyMeter::Counters energyCounters = {};
+    const bool pluginsEnabled;
+    bool memoryFootprintRecorded = false;
+    MemoryFootprint memoryFootprintBeforeTest = {};
+    MemoryFootprint memoryFootprintAfterTest = {};
+    const bool sampleDumpEnabled;
+    const Clock::time_point sampleDumpStart;
+    std::map<std::string, uint32_t> sampleDumpChannelIds = {};
+    SampleDump sampleDump = {};
 
     struct Metrics;
     struct MetricsStrings;
@@ -75,6 +106,7 @@ struct TestCaseStatistics::Metrics {
 
 struct TestCaseStatistics::MetricsStrings {
     MetricsStrings(const std::string &name, const Samples &samples, bool reachedInfinity);
+    static std::string generateLabel(const std::string &name, MeasurementUnit unit);
     Metrics metrics;
     std::string min;
     std::string max;
@@ -91,5 +123,4 @@ struct TestCaseStatistics::MetricsStrings {
     static std::string generateMedian(Value median);
     static std::string generateStandardDeviation(Value standardDeviation, bool reachedInfinity);
     static std::string generate(Value value);
-    static std::string generateLabel(const std::string &name, MeasurementUnit unit);
 };
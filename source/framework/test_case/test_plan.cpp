@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "test_plan.h"
+
+#include "framework/benchmark_info.h"
+#include "framework/configuration.h"
+#include "framework/utility/error.h"
+
+#include <fstream>
+
+static const std::string &getExportFilePath() {
+    return Configuration::get().exportPlan;
+}
+
+bool TestPlan::isExportEnabled() {
+    return !getExportFilePath().empty() || isCollecting();
+}
+
+bool TestPlan::beginExport(std::string &error) {
+    std::ofstream file{getExportFilePath(), std::ios::out | std::ios::trunc};
+    if (!file.good()) {
+        error = "Could not create test plan file " + getExportFilePath();
+        return false;
+    }
+    file << "# Test plan of " << BenchmarkInfo::get().getBenchmarkName() << '\n';
+    return true;
+}
+
+void TestPlan::exportConfiguration(const std::string &commandLine, const std::string &name) {
+    if (std::vector<Entry> *collectedEntries = getCollectedEntries(); collectedEntries != nullptr) {
+        collectedEntries->push_back({collectedEntries->size() + 1, commandLine, name});
+        return;
+    }
+
+    std::ofstream file{getExportFilePath(), std::ios::out | std::ios::app};
+    file << commandLine << '\n';
+    FATAL_ERROR_UNLESS(file.good(), "Could not write to test plan file");
+}
+
+void TestPlan::beginCollecting(std::vector<Entry> &entries) {
+    getCollectedEntries() = &entries;
+}
+
+void TestPlan::endCollecting() {
+    getCollectedEntries() = nullptr;
+}
+
+bool TestPlan::isCollecting() {
+    return getCollectedEntries() != nullptr;
+}
+
+bool TestPlan::load(const std::string &filePath, std::vector<Entry> &entries, std::string &error) {
+    std::ifstream file{filePath, std::ios::in};
+    if (!file.good()) {
+        error = "Could not open test plan file " + filePath;
+        return false;
+    }
+
+    std::string line{};
+    size_t lineNumber = 0;
+    while (std::getline(file, line)) {
+        lineNumber++;
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (line.find_first_not_of(" \t") == std::string::npos || line[0] == '#') {
+            continue;
+        }
+        entries.push_back({lineNumber, line});
+    }
+    return true;
+}
+
+std::vector<TestPlan::Entry> *&TestPlan::getCollectedEntries() {
+    static std::vector<Entry> *collectedEntries = nullptr;
+    return collectedEntries;
+}
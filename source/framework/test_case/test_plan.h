@@ -0,0 +1,38 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+// Test plans are text files with one single-test mode command line per line, e.g. "--test=UsmCopy --api=l0 --size=4KB ...".
+// With --exportPlan the benchmark writes command lines of all configurations matching current filters instead of running
+// them and --runPlan runs all configurations from a plan in one process. Plans can be freely edited, reordered or split
+// between machines. Empty lines and lines starting with '#' are ignored.
+class TestPlan {
+  public:
+    struct Entry {
+        size_t lineNumber;
+        std::string commandLine;
+        std::string name = {}; // name with config, known only for configurations exported to memory
+    };
+
+    static bool isExportEnabled();
+    static bool beginExport(std::string &error);
+    static void exportConfiguration(const std::string &commandLine, const std::string &name);
+
+    // Configurations can be also exported to memory, e.g. to schedule them within --timeBudget
+    static void beginCollecting(std::vector<Entry> &entries);
+    static void endCollecting();
+    static bool isCollecting();
+
+    static bool load(const std::string &filePath, std::vector<Entry> &entries, std::string &error);
+
+  private:
+    static std::vector<Entry> *&getCollectedEntries();
+};
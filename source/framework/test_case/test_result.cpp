@@ -26,6 +26,8 @@ const static std::unordered_map<TestResult, TestResultHelper::TestResultInfo> te
     {TestResult::FilteredOut,             { "FILTERED_OUT",        true ,        false,     true } },
     {TestResult::VerificationFail,        { "VERIF_FAIL",          true ,        true ,     false} },
     {TestResult::KernelBuildError,        { "KERNEL_BUILD_ERROR",  true ,        true ,     false} },
+    {TestResult::Crash,                   { "CRASH",               true ,        true ,     false} },
+    {TestResult::Timeout,                 { "TIMEOUT",             true ,        true ,     false} },
 };
 // clang-format on
 
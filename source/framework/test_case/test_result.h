@@ -25,7 +25,9 @@ enum class TestResult {
     Nooped,                  // Test was nooped, only print its name
     FilteredOut,             // Test was skipped because of passed argFilter
     VerificationFail,        // Results where incorrect
-    KernelBuildError         // Kernel could not be compiled
+    KernelBuildError,        // Kernel could not be compiled
+    Crash,                   // Test process was killed by a signal or an unhandled exception, used with --isolate
+    Timeout                  // Test process did not finish before --testTimeout and was killed, used with --isolate
 };
 
 struct TestResultHelper {
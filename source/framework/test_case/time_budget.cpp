@@ -0,0 +1,269 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "time_budget.h"
+
+#include "framework/benchmark_info.h"
+#include "framework/configuration.h"
+#include "framework/progress_reporter.h"
+#include "framework/test_case/configuration_durations.h"
+#include "framework/utility/result_history.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <map>
+
+// Part of the budget kept for durations longer than estimated, e.g. because of setup not proportional to iterations
+constexpr static double budgetReserve = 0.05;
+// Only this many last runs of a configuration are considered when looking for unstable or changed results
+constexpr static size_t recentRunsCount = 10;
+
+static double getMedian(std::vector<double> values) {
+    if (values.empty()) {
+        return 0;
+    }
+    std::sort(values.begin(), values.end());
+    const size_t middle = values.size() / 2;
+    return values.size() % 2 == 1 ? values[middle] : (values[middle - 1] + values[middle]) / 2;
+}
+
+bool TimeBudget::isEnabled() {
+    return Configuration::get().timeBudget > 0 && !Configuration::get().noop;
+}
+
+TimeBudget::TimeBudget(const std::vector<TestPlan::Entry> &entries)
+    : startTime(Clock::now()),
+      budgetSeconds(static_cast<double>(static_cast<size_t>(Configuration::get().timeBudget))) {
+    for (const auto &entry : entries) {
+        Item item{};
+        item.entry = entry;
+        item.name = entry.name;
+        items.push_back(std::move(item));
+    }
+}
+
+bool TimeBudget::load(std::string &error) {
+    for (auto &item : items) {
+        item.secondsPerIteration = ConfigurationDurations::get().getSecondsPerIteration(item.entry.commandLine);
+    }
+
+    const std::string &historyFile = Configuration::get().history;
+    if (historyFile.empty()) {
+        return true;
+    }
+    std::vector<ResultHistoryEntry> historyEntries{};
+    if (std::ifstream{historyFile}.good() && !ResultHistory::load(historyFile, historyEntries, error)) {
+        error = "Could not load history file " + historyFile + ": " + error;
+        return false;
+    }
+    loadHistory(historyEntries);
+    return true;
+}
+
+void TimeBudget::loadHistory(const std::vector<ResultHistoryEntry> &historyEntries) {
+    // Results of one run of a configuration share the timestamp and the main result is written first
+    std::map<std::string, std::vector<const ResultHistoryEntry *>> runsOfConfigurations{};
+    const std::string benchmarkName = BenchmarkInfo::get().getBenchmarkName();
+    for (const auto &historyEntry : historyEntries) {
+        if (historyEntry.benchmarkName != benchmarkName) {
+            continue;
+        }
+        auto &runs = runsOfConfigurations[historyEntry.configuration];
+        if (runs.empty() || runs.back()->unixTimeSeconds != historyEntry.unixTimeSeconds) {
+            runs.push_back(&historyEntry);
+        }
+    }
+
+    for (auto &item : items) {
+        // Configurations are stored by their names or by their command lines with --dumpCommandLines
+        auto runsIt = runsOfConfigurations.find(item.name);
+        if (runsIt == runsOfConfigurations.end()) {
+            runsIt = runsOfConfigurations.find(item.entry.commandLine);
+        }
+        if (runsIt == runsOfConfigurations.end()) {
+            continue;
+        }
+
+        const auto &runs = runsIt->second;
+        const ResultHistoryEntry &latest = *runs.back();
+        item.relativeDeviation = latest.relativeStandardDeviation;
+
+        std::vector<double> previousMeans{};
+        std::vector<double> previousDeviations{};
+        for (size_t runIndex = runs.size() - std::min(runs.size(), recentRunsCount + 1); runIndex + 1 < runs.size(); runIndex++) {
+            previousMeans.push_back(runs[runIndex]->mean);
+            previousDeviations.push_back(runs[runIndex]->relativeStandardDeviation);
+        }
+        if (previousDeviations.size() >= 2) {
+            item.unstable = latest.relativeStandardDeviation > std::max(0.01, 2 * getMedian(previousDeviations));
+        }
+        if (!previousMeans.empty() && latest.samplesCount > 0) {
+            const double previousMean = getMedian(previousMeans);
+            const double threshold = std::max(0.02, 3 * latest.relativeStandardDeviation / std::sqrt(static_cast<double>(latest.samplesCount)));
+            item.changed = previousMean != 0 && std::abs(latest.mean - previousMean) / std::abs(previousMean) > threshold;
+        }
+    }
+}
+
+void TimeBudget::schedule() {
+    // Unknown durations and deviations are assumed to be typical for the run
+    std::vector<double> knownSecondsPerIteration{};
+    std::vector<double> knownDeviations{};
+    for (const auto &item : items) {
+        if (item.secondsPerIteration >= 0) {
+            knownSecondsPerIteration.push_back(item.secondsPerIteration);
+        }
+        if (item.relativeDeviation >= 0) {
+            knownDeviations.push_back(item.relativeDeviation);
+        }
+    }
+    // Without any durations, all configurations are assumed to fit with --iterations iterations
+    const double plannedSeconds = budgetSeconds * (1 - budgetReserve);
+    const double defaultIterations = static_cast<double>(static_cast<size_t>(Configuration::get().iterations));
+    const double typicalSecondsPerIteration = knownSecondsPerIteration.empty() ? plannedSeconds / std::max<double>(1, items.size() * defaultIterations) : getMedian(knownSecondsPerIteration);
+    const double typicalDeviation = knownDeviations.empty() ? 0.05 : getMedian(knownDeviations);
+    for (auto &item : items) {
+        const bool hasHistory = item.relativeDeviation >= 0;
+        if (item.secondsPerIteration < 0) {
+            item.secondsPerIteration = typicalSecondsPerIteration;
+        }
+        if (!hasHistory) {
+            item.relativeDeviation = typicalDeviation;
+        }
+        item.relativeDeviation = std::max(item.relativeDeviation, 0.001);
+        item.weight = (item.unstable || item.changed) ? 4 : hasHistory ? 1 : 2;
+    }
+
+    // Coverage comes first, configurations with the highest priority and the cheapest ones are picked while they fit
+    std::vector<size_t> order(items.size());
+    for (size_t index = 0; index < order.size(); index++) {
+        order[index] = index;
+    }
+    std::stable_sort(order.begin(), order.end(), [this](size_t left, size_t right) {
+        if (items[left].weight != items[right].weight) {
+            return items[left].weight > items[right].weight;
+        }
+        return items[left].secondsPerIteration < items[right].secondsPerIteration;
+    });
+    std::vector<size_t> selected{};
+    double minimalSeconds = 0;
+    for (const size_t index : order) {
+        const double seconds = getEstimatedSeconds(items[index], getMinIterations());
+        if (minimalSeconds + seconds > plannedSeconds) {
+            items[index].skipReason = "does not fit in the budget";
+            continue;
+        }
+        minimalSeconds += seconds;
+        selected.push_back(index);
+    }
+
+    // Sum of weighted squared relative standard errors, w * d^2 / n, with total time fixed is minimal when n is
+    // proportional to d * sqrt(w / c). The factor is found by bisection, since iterations are clamped.
+    const auto getIterations = [this](const Item &item, double factor) {
+        const double iterations = factor * item.relativeDeviation * std::sqrt(item.weight / std::max(item.secondsPerIteration, 1e-9));
+        return static_cast<size_t>(std::clamp(iterations, static_cast<double>(getMinIterations()), static_cast<double>(getMaxIterations())));
+    };
+    const auto getTotalSeconds = [&](double factor) {
+        double totalSeconds = 0;
+        for (const size_t index : selected) {
+            totalSeconds += getEstimatedSeconds(items[index], getIterations(items[index], factor));
+        }
+        return totalSeconds;
+    };
+    double lowFactor = 0;
+    double highFactor = 1;
+    while (getTotalSeconds(highFactor) <= plannedSeconds && highFactor < 1e30) {
+        highFactor *= 2;
+    }
+    for (int step = 0; step < 64; step++) {
+        const double factor = (lowFactor + highFactor) / 2;
+        (getTotalSeconds(factor) <= plannedSeconds ? lowFactor : highFactor) = factor;
+    }
+    for (const size_t index : selected) {
+        items[index].plannedIterations = getIterations(items[index], lowFactor);
+    }
+
+    // Prioritized configurations run first, so they are not skipped when the run falls behind the plan
+    std::stable_sort(selected.begin(), selected.end(), [this](size_t left, size_t right) {
+        return items[left].weight != items[right].weight ? items[left].weight > items[right].weight : left < right;
+    });
+    scheduled = std::move(selected);
+}
+
+const TestPlan::Entry &TimeBudget::getEntry(size_t position) const {
+    return items[scheduled[position]].entry;
+}
+
+size_t TimeBudget::beginConfiguration(size_t position) {
+    Item &item = items[scheduled[position]];
+    currentStartTime = Clock::now();
+
+    // Durations measured so far correct the estimates of remaining configurations
+    const double remainingSeconds = budgetSeconds - Seconds(currentStartTime - startTime).count();
+    const double correction = plannedSecondsDone > 0 ? measuredSecondsDone / plannedSecondsDone : 1;
+    double remainingPlannedSeconds = 0;
+    for (size_t remainingPosition = position; remainingPosition < scheduled.size(); remainingPosition++) {
+        const Item &remainingItem = items[scheduled[remainingPosition]];
+        remainingPlannedSeconds += getEstimatedSeconds(remainingItem, remainingItem.plannedIterations) * correction;
+    }
+
+    item.iterations = item.plannedIterations;
+    if (remainingPlannedSeconds > remainingSeconds) {
+        const double scale = std::max(0.0, remainingSeconds / remainingPlannedSeconds);
+        item.iterations = std::max(getMinIterations(), static_cast<size_t>(static_cast<double>(item.plannedIterations) * scale));
+    }
+    if (getEstimatedSeconds(item, item.iterations) * correction > remainingSeconds) {
+        item.iterations = 0;
+        item.skipReason = "budget exhausted";
+    }
+    return item.iterations;
+}
+
+void TimeBudget::endConfiguration(size_t position) {
+    Item &item = items[scheduled[position]];
+    item.measuredSeconds = Seconds(Clock::now() - currentStartTime).count();
+    plannedSecondsDone += getEstimatedSeconds(item, item.iterations);
+    measuredSecondsDone += item.measuredSeconds;
+}
+
+void TimeBudget::print() const {
+    size_t runCount = 0;
+    size_t prioritizedCount = 0;
+    for (const auto &item : items) {
+        runCount += item.iterations > 0 ? 1 : 0;
+        prioritizedCount += (item.iterations > 0 && item.weight > 2) ? 1 : 0;
+    }
+    std::cout << "\nTime budget " << ProgressReporter::formatDuration(Seconds(budgetSeconds)) << ", used "
+              << ProgressReporter::formatDuration(Clock::now() - startTime) << ", run " << runCount << " of " << items.size()
+              << " test configurations, " << prioritizedCount << " of them prioritized as unstable or changed\n";
+    if (runCount == items.size()) {
+        std::cout.flush();
+        return;
+    }
+
+    std::cout << "Skipped test configurations:\n";
+    for (const auto &item : items) {
+        if (item.iterations == 0) {
+            std::cout << "  " << item.name << " - " << item.skipReason << '\n';
+        }
+    }
+    std::cout.flush();
+}
+
+double TimeBudget::getEstimatedSeconds(const Item &item, size_t iterations) const {
+    return item.secondsPerIteration * static_cast<double>(iterations);
+}
+
+size_t TimeBudget::getMinIterations() const {
+    return std::min(size_t{3}, static_cast<size_t>(Configuration::get().iterations));
+}
+
+size_t TimeBudget::getMaxIterations() const {
+    return 10 * static_cast<size_t>(Configuration::get().iterations);
+}
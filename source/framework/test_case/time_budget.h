@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/test_case/test_plan.h"
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+struct ResultHistoryEntry;
+
+// Runs test configurations within a fixed time, enabled with --timeBudget. Configurations come from a nooped pass over
+// --runPlan or, in all-tests mode, over all tests. Each configuration gets a number of iterations based on its duration
+// in previous runs from ConfigurationDurations and relative standard deviation of its last result from --history. Iterations are split to minimize
+// the sum of squared relative standard errors, so noisy and cheap configurations get more of them. Configurations which
+// were recently unstable or changed their result are run first and weigh more, configurations without any history come
+// next. When even the minimal number of iterations of all configurations does not fit, the ones with the lowest priority
+// are skipped. Durations are measured again during the run, iterations of remaining configurations are scaled down if
+// the run falls behind the plan and configurations which no longer fit are skipped. Skipped configurations are reported
+// at the end.
+class TimeBudget {
+  public:
+    using Clock = std::chrono::steady_clock;
+    using Seconds = std::chrono::duration<double>;
+
+    static bool isEnabled();
+
+    explicit TimeBudget(const std::vector<TestPlan::Entry> &entries);
+    bool load(std::string &error);
+    void schedule();
+
+    // Configurations are run in the scheduled order. Zero iterations means the configuration is skipped.
+    size_t getScheduledCount() const { return scheduled.size(); }
+    const TestPlan::Entry &getEntry(size_t position) const;
+    size_t beginConfiguration(size_t position);
+    void endConfiguration(size_t position);
+
+    void print() const;
+
+  private:
+    struct Item {
+        TestPlan::Entry entry;
+        std::string name;
+        double secondsPerIteration = -1; // negative if unknown
+        double relativeDeviation = -1;   // negative if unknown
+        bool unstable = false;
+        bool changed = false;
+        double weight = 1;
+        size_t plannedIterations = 0;
+        size_t iterations = 0;
+        double measuredSeconds = 0;
+        std::string skipReason = {};
+    };
+    void loadHistory(const std::vector<ResultHistoryEntry> &historyEntries);
+    double getEstimatedSeconds(const Item &item, size_t iterations) const;
+    size_t getMinIterations() const;
+    size_t getMaxIterations() const;
+
+    const Clock::time_point startTime;
+    const double budgetSeconds;
+    std::vector<Item> items = {};
+    std::vector<size_t> scheduled = {};
+    Clock::time_point currentStartTime = {};
+    double plannedSecondsDone = 0;
+    double measuredSecondsDone = 0;
+};
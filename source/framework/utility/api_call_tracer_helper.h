@@ -0,0 +1,22 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <string>
+
+// Informs the api_call_tracer library (source/tools/api_call_tracer) about test boundaries, so that it can
+// attribute intercepted API calls to test configurations. Does nothing if the library is not preloaded.
+struct ApiCallTracerHelper {
+    constexpr static const char *testBeginSymbol = "computeBenchmarksApiCallTracerTestBegin";
+    constexpr static const char *testEndSymbol = "computeBenchmarksApiCallTracerTestEnd";
+    using TestBeginFunction = void (*)(const char *testCaseNameWithConfig);
+    using TestEndFunction = void (*)();
+
+    static void notifyTestBegin(const std::string &testCaseNameWithConfig);
+    static void notifyTestEnd();
+};
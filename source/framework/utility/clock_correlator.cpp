@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "clock_correlator.h"
+
+#include "framework/utility/bit_operations_helper.h"
+#include "framework/utility/error.h"
+
+#include <cmath>
+
+ClockCorrelator::ClockCorrelator(uint32_t deviceTimestampValidBits, double deviceTimerResolutionNanoseconds, size_t maxSamples)
+    : deviceTimestampValidBits(deviceTimestampValidBits),
+      deviceTimerResolutionNanoseconds(deviceTimerResolutionNanoseconds),
+      maxSamples(maxSamples),
+      nanosecondsPerTick(deviceTimerResolutionNanoseconds) {
+    FATAL_ERROR_IF(deviceTimestampValidBits == 0, "Device timestamps must have at least one valid bit");
+    FATAL_ERROR_IF(maxSamples < 2, "At least two samples are needed to measure drift");
+}
+
+bool ClockCorrelator::sample() {
+    FATAL_ERROR_IF(source == nullptr, "No timestamp source set for ClockCorrelator");
+    TimestampPair pair{};
+    if (!source(pair)) {
+        return false;
+    }
+    addSample(pair);
+    lastSampleTime = std::chrono::steady_clock::now();
+    return true;
+}
+
+bool ClockCorrelator::calibrate(size_t samplesCount) {
+    for (auto i = 0u; i < samplesCount; i++) {
+        if (!sample()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ClockCorrelator::sampleIfOlderThan(std::chrono::nanoseconds maxAge) {
+    if (isCalibrated() && std::chrono::steady_clock::now() - lastSampleTime < maxAge) {
+        return true;
+    }
+    return sample();
+}
+
+void ClockCorrelator::addSample(TimestampPair pair) {
+    const uint64_t truncatedDeviceTimestamp = BitHelper::isolateLowerNBits(pair.deviceTimestamp, deviceTimestampValidBits);
+    if (samples.empty()) {
+        pair.deviceTimestamp = truncatedDeviceTimestamp;
+    } else {
+        pair.deviceTimestamp = unwrap(truncatedDeviceTimestamp, samples.back().deviceTimestamp, deviceTimestampValidBits);
+    }
+
+    samples.push_back(pair);
+    if (samples.size() > maxSamples) {
+        samples.pop_front();
+    }
+    fit();
+}
+
+uint64_t ClockCorrelator::toHostNanoseconds(uint64_t deviceTimestamp, uint32_t validBits) const {
+    FATAL_ERROR_IF(!isCalibrated(), "ClockCorrelator used before taking any samples");
+
+    // Timestamps may have fewer valid bits than the correlated counter, e.g. kernel timestamps
+    const uint64_t unwrappedTimestamp = unwrap(BitHelper::isolateLowerNBits(deviceTimestamp, validBits), samples.back().deviceTimestamp, validBits);
+    const double ticksSinceBase = static_cast<double>(static_cast<int64_t>(unwrappedTimestamp - base.deviceTimestamp));
+    const double nanosecondsSinceBase = offsetNanoseconds + nanosecondsPerTick * ticksSinceBase;
+    return base.hostNanoseconds + static_cast<int64_t>(std::llround(nanosecondsSinceBase));
+}
+
+double ClockCorrelator::getDriftPartsPerMillion() const {
+    return (nanosecondsPerTick / deviceTimerResolutionNanoseconds - 1) * 1e6;
+}
+
+uint64_t ClockCorrelator::unwrap(uint64_t truncatedTimestamp, uint64_t reference, uint32_t validBits) {
+    if (validBits >= 64) {
+        return truncatedTimestamp;
+    }
+
+    // Pick the value with given lower bits, which is the closest to the reference
+    const uint64_t period = 1ull << validBits;
+    const uint64_t mask = period - 1;
+    const uint64_t candidate = (reference & ~mask) | (truncatedTimestamp & mask);
+    if (candidate > reference && candidate - reference > period / 2 && candidate >= period) {
+        return candidate - period;
+    }
+    if (candidate < reference && reference - candidate > period / 2) {
+        return candidate + period;
+    }
+    return candidate;
+}
+
+void ClockCorrelator::fit() {
+    base = samples.front();
+
+    // With a single sample there is no information about drift, so assume nominal timer resolution
+    if (samples.size() == 1) {
+        offsetNanoseconds = 0;
+        nanosecondsPerTick = deviceTimerResolutionNanoseconds;
+        return;
+    }
+
+    double meanTicks = 0;
+    double meanNanoseconds = 0;
+    for (const auto &pair : samples) {
+        meanTicks += static_cast<double>(pair.deviceTimestamp - base.deviceTimestamp);
+        meanNanoseconds += static_cast<double>(static_cast<int64_t>(pair.hostNanoseconds - base.hostNanoseconds));
+    }
+    meanTicks /= samples.size();
+    meanNanoseconds /= samples.size();
+
+    double covariance = 0;
+    double variance = 0;
+    for (const auto &pair : samples) {
+        const double ticks = static_cast<double>(pair.deviceTimestamp - base.deviceTimestamp) - meanTicks;
+        const double nanoseconds = static_cast<double>(static_cast<int64_t>(pair.hostNanoseconds - base.hostNanoseconds)) - meanNanoseconds;
+        covariance += ticks * nanoseconds;
+        variance += ticks * ticks;
+    }
+
+    nanosecondsPerTick = variance > 0 ? covariance / variance : deviceTimerResolutionNanoseconds;
+    offsetNanoseconds = meanNanoseconds - nanosecondsPerTick * meanTicks;
+}
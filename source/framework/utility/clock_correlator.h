@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+
+// Puts device timestamps on the host timeline. Pairs of host and device timestamps taken at the same moment are
+// collected from a TimestampSource (e.g. zeDeviceGetGlobalTimestamps or clGetDeviceAndHostTimer) and a line
+// host = offset + drift * device is fitted to them with linear regression. Only the most recent pairs are used,
+// so calling sample() periodically keeps the conversion accurate when the clocks drift apart during long tests.
+//
+// Device timestamps have limited number of valid bits and wrap around. Pairs are unwrapped into a continuous
+// timeline as they are added and converted timestamps are unwrapped relative to the most recent pair, so they
+// have to be taken within half of the wraparound period from it.
+//
+// The class does not call any compute API by itself. Pairs can be passed with addSample(), which allows testing it
+// with synthetic clocks. See L0::createClockCorrelator and OCL::createClockCorrelator for API-specific sources.
+class ClockCorrelator {
+  public:
+    struct TimestampPair {
+        uint64_t hostNanoseconds;
+        uint64_t deviceTimestamp;
+    };
+    using TimestampSource = std::function<bool(TimestampPair &pair)>;
+
+    ClockCorrelator(uint32_t deviceTimestampValidBits, double deviceTimerResolutionNanoseconds, size_t maxSamples = 32);
+
+    void setTimestampSource(const TimestampSource &source) { this->source = source; }
+    bool sample();
+    bool calibrate(size_t samplesCount);
+    bool sampleIfOlderThan(std::chrono::nanoseconds maxAge);
+
+    void addSample(TimestampPair pair);
+    bool isCalibrated() const { return !samples.empty(); }
+    size_t getSamplesCount() const { return samples.size(); }
+
+    uint64_t toHostNanoseconds(uint64_t deviceTimestamp) const { return toHostNanoseconds(deviceTimestamp, deviceTimestampValidBits); }
+    uint64_t toHostNanoseconds(uint64_t deviceTimestamp, uint32_t validBits) const;
+    double getDriftPartsPerMillion() const;
+
+    static uint64_t unwrap(uint64_t truncatedTimestamp, uint64_t reference, uint32_t validBits);
+
+  private:
+    void fit();
+
+    const uint32_t deviceTimestampValidBits;
+    const double deviceTimerResolutionNanoseconds;
+    const size_t maxSamples;
+    TimestampSource source = {};
+    std::chrono::steady_clock::time_point lastSampleTime = {};
+
+    // Unwrapped device timestamps, so they increase even if the device counter wrapped around
+    std::deque<TimestampPair> samples = {};
+
+    // Result of the fit, relative to the oldest sample to retain precision of doubles
+    TimestampPair base = {};
+    double offsetNanoseconds = 0;
+    double nanosecondsPerTick = 0;
+};
@@ -10,13 +10,14 @@
 #include "framework/utility/error.h"
 #include "framework/utility/string_utils.h"
 
+#include <algorithm>
 #include <unordered_set>
 
 CommandLineArgument::CommandLineArgument(const char *token) {
     this->valid = parseArgumentToKeyValue(token, this->key, this->value);
 }
 
-bool CommandLineArgument::parseArguments(int argc, char **argv, CommandLineArguments &outArguments, std::string &outErrorMessage) {
+bool CommandLineArgument::parseArguments(int argc, char **argv, CommandLineArguments &outArguments, std::string &outErrorMessage, const std::vector<std::string> &repeatableKeys) {
     std::unordered_set<std::string> allKeys = {};
 
     for (int argIndex = 1; argIndex < argc; argIndex++) {
@@ -30,9 +31,10 @@ bool CommandLineArgument::parseArguments(int argc, char **argv, CommandLineArgum
         }
 
         // Check for duplicates
+        const bool repeatable = std::find(repeatableKeys.begin(), repeatableKeys.end(), arg.getKey()) != repeatableKeys.end();
         const auto [iterator, inserted] = allKeys.insert(arg.getKey());
         (void)iterator;
-        if (!inserted) {
+        if (!inserted && !repeatable) {
             outErrorMessage = std::string("Argument with a key \"") + arg.getKey() + "\" is provided more than once";
             outArguments.clear();
             return false;
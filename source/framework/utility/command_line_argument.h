@@ -20,7 +20,8 @@ class CommandLineArgument {
     CommandLineArgument(CommandLineArgument &&) = default;
     CommandLineArgument &operator=(CommandLineArgument &&) = default;
 
-    static bool parseArguments(int argc, char **argv, CommandLineArguments &outArguments, std::string &outErrorMessage);
+    // Each key can be passed once, except the repeatable ones, which collect values of all their occurrences
+    static bool parseArguments(int argc, char **argv, CommandLineArguments &outArguments, std::string &outErrorMessage, const std::vector<std::string> &repeatableKeys = {});
     static std::vector<const CommandLineArgument *> getUnprocessedArguments(const CommandLineArguments &arguments);
 
     void markAsProcessed();
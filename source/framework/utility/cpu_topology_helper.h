@@ -0,0 +1,22 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+struct CpuTopologyHelper {
+    struct CpuInfo {
+        size_t cpuIndex;   // logical CPU index, as used by the OS for affinity masks
+        size_t packageId;  // physical socket
+        size_t l3DomainId; // CPUs sharing the same last level cache (CCX on AMD, socket on most Intel parts)
+    };
+
+    static std::vector<CpuInfo> getAvailableCpus(); // OS-specific implementation
+    static bool pinCurrentThread(size_t cpuIndex);  // OS-specific implementation
+};
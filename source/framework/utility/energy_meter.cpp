@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "energy_meter.h"
+
+#include "framework/configuration.h"
+#include "framework/utility/error.h"
+
+#include <mutex>
+
+namespace {
+struct TimedRegionsState {
+    std::mutex mutex;
+    size_t activeRegions = 0;
+    size_t completedRegions = 0;
+    EnergyMeter::Counters regionStart = {};
+    EnergyMeter::Energy accumulatedEnergy = {};
+};
+
+TimedRegionsState &getTimedRegionsState() {
+    static TimedRegionsState state{};
+    return state;
+}
+} // namespace
+
+bool EnergyMeter::isEnabled() {
+    return Configuration::get().energy && !getDomains().empty();
+}
+
+const std::vector<EnergyMeter::Domain> &EnergyMeter::getDomains() {
+    static const std::vector<Domain> domains = []() {
+        auto result = discoverDomains();
+        if (result.empty()) {
+            printMessageLine("WARNING", "No readable RAPL energy counters found, energy will not be reported");
+        }
+        return result;
+    }();
+    return domains;
+}
+
+EnergyMeter::Energy EnergyMeter::getEnergyBetween(const Counters &start, const Counters &end) {
+    const auto &domains = getDomains();
+    Energy result(domains.size());
+    for (auto domainIndex = 0u; domainIndex < domains.size(); domainIndex++) {
+        const uint64_t deltaMicrojoules = getCounterDelta(start[domainIndex], end[domainIndex], domains[domainIndex].maxEnergyRangeMicrojoules);
+        result[domainIndex] = deltaMicrojoules / 1e6;
+    }
+    return result;
+}
+
+uint64_t EnergyMeter::getCounterDelta(uint64_t start, uint64_t end, uint64_t maxEnergyRange) {
+    // Counters wrap around after reaching max_energy_range_uj. Assume there was at most one wraparound, which
+    // takes minutes even on the largest servers.
+    if (end >= start) {
+        return end - start;
+    }
+    return maxEnergyRange - start + end + 1;
+}
+
+void EnergyMeter::beginTimedRegion() {
+    auto &state = getTimedRegionsState();
+    std::lock_guard<std::mutex> lock{state.mutex};
+
+    // Overlapping regions from multiple threads are measured as one
+    if (state.activeRegions++ == 0) {
+        state.regionStart = readCounters();
+    }
+}
+
+void EnergyMeter::endTimedRegion() {
+    auto &state = getTimedRegionsState();
+    std::lock_guard<std::mutex> lock{state.mutex};
+    if (state.activeRegions == 0 || --state.activeRegions != 0) {
+        return;
+    }
+
+    const Energy regionEnergy = getEnergyBetween(state.regionStart, readCounters());
+    state.accumulatedEnergy.resize(regionEnergy.size());
+    for (auto domainIndex = 0u; domainIndex < regionEnergy.size(); domainIndex++) {
+        state.accumulatedEnergy[domainIndex] += regionEnergy[domainIndex];
+    }
+    state.completedRegions++;
+}
+
+EnergyMeter::Energy EnergyMeter::takeIterationEnergy(Counters &lastCounters) {
+    auto &state = getTimedRegionsState();
+    std::lock_guard<std::mutex> lock{state.mutex};
+
+    const Counters currentCounters = readCounters();
+    Energy result{};
+    if (state.completedRegions > 0) {
+        result = state.accumulatedEnergy;
+    } else {
+        result = getEnergyBetween(lastCounters, currentCounters);
+    }
+
+    lastCounters = currentCounters;
+    state.accumulatedEnergy.clear();
+    state.completedRegions = 0;
+    return result;
+}
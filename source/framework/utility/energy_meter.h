@@ -0,0 +1,40 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Measures energy consumed by the host, e.g. CPU package and DRAM, with RAPL counters exposed by the Linux powercap
+// interface. Energy is accumulated over timed regions (everything between Timer::measureStart and measureEnd) and
+// reported per iteration by TestCaseStatistics. Tests without timed regions get energy consumed between pushing
+// consecutive results.
+class EnergyMeter {
+  public:
+    struct Domain {
+        std::string name;
+        std::string energyCounterPath;
+        uint64_t maxEnergyRangeMicrojoules;
+    };
+    using Counters = std::vector<uint64_t>;
+    using Energy = std::vector<double>;
+
+    static bool isEnabled();
+    static const std::vector<Domain> &getDomains();
+    static Counters readCounters();
+    static Energy getEnergyBetween(const Counters &start, const Counters &end);
+
+    static void beginTimedRegion();
+    static void endTimedRegion();
+    static Energy takeIterationEnergy(Counters &lastCounters);
+
+  private:
+    static std::vector<Domain> discoverDomains();
+    static uint64_t getCounterDelta(uint64_t start, uint64_t end, uint64_t maxEnergyRange);
+};
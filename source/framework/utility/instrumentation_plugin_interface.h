@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+// C interface between benchmarks and instrumentation plugins loaded with --plugin=<path>. This header has no
+// dependencies on the rest of the framework, so plugins can be built out of tree by copying it.
+//
+// A plugin is a shared library exporting computeBenchmarksPluginInit. The benchmark calls it once after loading the
+// library and the plugin fills in the callbacks it is interested in. Unused callbacks can be left as null.
+//
+// Iteration callbacks are called from Timer::measureStart and Timer::measureEnd, so they must be cheap and, because
+// some benchmarks measure from multiple threads, thread-safe. Other callbacks are called from the main thread.
+
+#include <stdint.h>
+
+#define COMPUTE_BENCHMARKS_PLUGIN_API_VERSION 1u
+#define COMPUTE_BENCHMARKS_PLUGIN_INIT_SYMBOL "computeBenchmarksPluginInit"
+
+#if defined(_WIN32)
+#define COMPUTE_BENCHMARKS_PLUGIN_EXPORT __declspec(dllexport)
+#else
+#define COMPUTE_BENCHMARKS_PLUGIN_EXPORT __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Passed to onSamplePush for the main result of each iteration. Every pushSample call adds one value to a sample
+// group labeled "<groupName> [<unitLabel>]", which is printed along with the benchmark's own results. A plugin
+// contributing a group must push exactly one value to it per main result, otherwise the test reports an error.
+typedef struct ComputeBenchmarksSampleSink {
+    void *context;
+    void (*pushSample)(void *context, const char *groupName, const char *unitLabel, double value);
+} ComputeBenchmarksSampleSink;
+
+typedef struct ComputeBenchmarksPluginCallbacks {
+    void *userData;
+
+    void (*onTestBegin)(void *userData, const char *testCaseNameWithConfig);
+    void (*onTestEnd)(void *userData, const char *testCaseNameWithConfig, int succeeded);
+    void (*onIterationBegin)(void *userData);
+    void (*onIterationEnd)(void *userData, uint64_t durationNanoseconds);
+
+    // groupName is empty for the main result of an iteration and sink is null for other groups
+    void (*onSamplePush)(void *userData, const char *groupName, const char *unitLabel, double value, const ComputeBenchmarksSampleSink *sink);
+
+    // Called once when the benchmark exits
+    void (*onUnload)(void *userData);
+} ComputeBenchmarksPluginCallbacks;
+
+// Returns zero on success. apiVersion is COMPUTE_BENCHMARKS_PLUGIN_API_VERSION of the benchmark, plugins built against
+// a different version should fail.
+typedef int (*ComputeBenchmarksPluginInitFunction)(uint32_t apiVersion, ComputeBenchmarksPluginCallbacks *callbacks);
+
+#ifdef __cplusplus
+}
+#endif
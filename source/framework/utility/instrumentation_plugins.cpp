@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "instrumentation_plugins.h"
+
+namespace {
+struct LoadedPlugins {
+    std::vector<ComputeBenchmarksPluginCallbacks> callbacks = {};
+
+    ~LoadedPlugins() {
+        // Libraries are never closed, since plugins may have started threads or registered atexit handlers
+        for (const auto &plugin : callbacks) {
+            if (plugin.onUnload != nullptr) {
+                plugin.onUnload(plugin.userData);
+            }
+        }
+    }
+};
+
+LoadedPlugins &getLoadedPlugins() {
+    static LoadedPlugins plugins{};
+    return plugins;
+}
+} // namespace
+
+bool InstrumentationPlugins::load(const std::vector<std::string> &paths, std::string &errors) {
+    auto &plugins = getLoadedPlugins();
+    for (const auto &path : paths) {
+        std::string error{};
+        void *library = openLibrary(path, error);
+        if (library == nullptr) {
+            errors += "Could not load plugin " + path + ": " + error + "\n";
+            continue;
+        }
+
+        const auto init = reinterpret_cast<ComputeBenchmarksPluginInitFunction>(findSymbol(library, COMPUTE_BENCHMARKS_PLUGIN_INIT_SYMBOL));
+        if (init == nullptr) {
+            errors += "Plugin " + path + " does not export " COMPUTE_BENCHMARKS_PLUGIN_INIT_SYMBOL "\n";
+            continue;
+        }
+
+        ComputeBenchmarksPluginCallbacks callbacks{};
+        if (const int result = init(COMPUTE_BENCHMARKS_PLUGIN_API_VERSION, &callbacks); result != 0) {
+            errors += "Plugin " + path + " failed to initialize with code " + std::to_string(result) + "\n";
+            continue;
+        }
+        plugins.callbacks.push_back(callbacks);
+    }
+    return errors.empty();
+}
+
+bool InstrumentationPlugins::isAnyLoaded() {
+    return !getLoadedPlugins().callbacks.empty();
+}
+
+void InstrumentationPlugins::notifyTestBegin(const std::string &testCaseNameWithConfig) {
+    for (const auto &plugin : getLoadedPlugins().callbacks) {
+        if (plugin.onTestBegin != nullptr) {
+            plugin.onTestBegin(plugin.userData, testCaseNameWithConfig.c_str());
+        }
+    }
+}
+
+void InstrumentationPlugins::notifyTestEnd(const std::string &testCaseNameWithConfig, bool succeeded) {
+    for (const auto &plugin : getLoadedPlugins().callbacks) {
+        if (plugin.onTestEnd != nullptr) {
+            plugin.onTestEnd(plugin.userData, testCaseNameWithConfig.c_str(), succeeded);
+        }
+    }
+}
+
+void InstrumentationPlugins::notifyIterationBegin() {
+    for (const auto &plugin : getLoadedPlugins().callbacks) {
+        if (plugin.onIterationBegin != nullptr) {
+            plugin.onIterationBegin(plugin.userData);
+        }
+    }
+}
+
+void InstrumentationPlugins::notifyIterationEnd(std::chrono::nanoseconds duration) {
+    for (const auto &plugin : getLoadedPlugins().callbacks) {
+        if (plugin.onIterationEnd != nullptr) {
+            plugin.onIterationEnd(plugin.userData, static_cast<uint64_t>(duration.count()));
+        }
+    }
+}
+
+void InstrumentationPlugins::notifySamplePush(const std::string &groupName, const std::string &unitLabel, double value, const ComputeBenchmarksSampleSink *sink) {
+    for (const auto &plugin : getLoadedPlugins().callbacks) {
+        if (plugin.onSamplePush != nullptr) {
+            plugin.onSamplePush(plugin.userData, groupName.c_str(), unitLabel.c_str(), value, sink);
+        }
+    }
+}
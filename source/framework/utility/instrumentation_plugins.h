@@ -0,0 +1,33 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/utility/instrumentation_plugin_interface.h"
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+// Loads instrumentation plugins passed with --plugin and forwards benchmark events to them. See
+// instrumentation_plugin_interface.h for the interface plugins have to implement. Plugins are loaded once
+// at startup and stay loaded until the benchmark exits.
+class InstrumentationPlugins {
+  public:
+    static bool load(const std::vector<std::string> &paths, std::string &errors);
+    static bool isAnyLoaded();
+
+    static void notifyTestBegin(const std::string &testCaseNameWithConfig);
+    static void notifyTestEnd(const std::string &testCaseNameWithConfig, bool succeeded);
+    static void notifyIterationBegin();
+    static void notifyIterationEnd(std::chrono::nanoseconds duration);
+    static void notifySamplePush(const std::string &groupName, const std::string &unitLabel, double value, const ComputeBenchmarksSampleSink *sink);
+
+  private:
+    static void *openLibrary(const std::string &path, std::string &error);
+    static void *findSymbol(void *library, const char *symbol);
+};
@@ -0,0 +1,27 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+// File opened for appending, in which every append reaches the storage before returning. Contents written so far
+// survive a crash of the process or a reset of the machine, except for the append which was in progress at the time.
+class JournalFile {
+  public:
+    explicit JournalFile(const std::string &filePath);
+    ~JournalFile();
+    JournalFile(const JournalFile &) = delete;
+    JournalFile &operator=(const JournalFile &) = delete;
+
+    bool isValid() const { return handle != -1; }
+    bool append(const std::string &data);
+
+  private:
+    intptr_t handle = -1;
+};
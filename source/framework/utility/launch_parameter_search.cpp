@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "launch_parameter_search.h"
+
+#include <cstdlib>
+#include <limits>
+
+LaunchParameterSearch::LaunchParameterSearch(const std::vector<size_t> &workgroupSizes, const std::vector<size_t> &workgroupCounts)
+    : workgroupSizes(workgroupSizes),
+      workgroupCounts(workgroupCounts) {}
+
+bool LaunchParameterSearch::search(const Point &start, const Objective &objective) {
+    evaluations.clear();
+    evaluatedIndices.clear();
+    infeasibleIndices.clear();
+    if (workgroupSizes.empty() || workgroupCounts.empty()) {
+        return false;
+    }
+
+    climb({getClosestIndex(workgroupSizes, start.workgroupSize), getClosestIndex(workgroupCounts, start.workgroupCount)}, objective);
+    const size_t sizesCount = workgroupSizes.size();
+    const size_t countsCount = workgroupCounts.size();
+    const GridIndex restarts[] = {
+        {sizesCount / 4, countsCount / 4},
+        {sizesCount * 3 / 4, countsCount / 4},
+        {sizesCount / 4, countsCount * 3 / 4},
+        {sizesCount * 3 / 4, countsCount * 3 / 4},
+    };
+    for (const GridIndex &restart : restarts) {
+        if (evaluations.size() >= maxEvaluations) {
+            break;
+        }
+        if (evaluatedIndices.find(restart) == evaluatedIndices.end() && !isPruned(restart)) {
+            climb(restart, objective);
+        }
+    }
+
+    bool found = false;
+    for (size_t evaluationIndex = 0; evaluationIndex < evaluations.size(); evaluationIndex++) {
+        const Evaluation &evaluation = evaluations[evaluationIndex];
+        if (evaluation.feasible && (!found || evaluation.value < evaluations[bestEvaluation].value)) {
+            bestEvaluation = evaluationIndex;
+            found = true;
+        }
+    }
+    return found;
+}
+
+std::vector<size_t> LaunchParameterSearch::getPowersOfTwo(size_t min, size_t max) {
+    std::vector<size_t> result{};
+    for (size_t value = 1; value <= max && value != 0; value *= 2) {
+        if (value >= min) {
+            result.push_back(value);
+        }
+    }
+    return result;
+}
+
+void LaunchParameterSearch::climb(GridIndex start, const Objective &objective) {
+    GridIndex current = start;
+    const Evaluation *currentEvaluation = evaluate(current, objective);
+    double currentValue = (currentEvaluation != nullptr && currentEvaluation->feasible) ? currentEvaluation->value : std::numeric_limits<double>::infinity();
+
+    while (evaluations.size() < maxEvaluations) {
+        GridIndex bestNeighbour = current;
+        double bestValue = currentValue;
+        for (int sizeStep = -1; sizeStep <= 1; sizeStep++) {
+            for (int countStep = -1; countStep <= 1; countStep++) {
+                const bool sizeInRange = (sizeStep >= 0 || current.first > 0) && (sizeStep <= 0 || current.first + 1 < workgroupSizes.size());
+                const bool countInRange = (countStep >= 0 || current.second > 0) && (countStep <= 0 || current.second + 1 < workgroupCounts.size());
+                if ((sizeStep == 0 && countStep == 0) || !sizeInRange || !countInRange) {
+                    continue;
+                }
+
+                const GridIndex neighbour{current.first + sizeStep, current.second + countStep};
+                const Evaluation *evaluation = evaluate(neighbour, objective);
+                if (evaluation != nullptr && evaluation->feasible && evaluation->value < bestValue) {
+                    bestNeighbour = neighbour;
+                    bestValue = evaluation->value;
+                }
+            }
+        }
+
+        // Improvements within noise do not move the search, the first feasible point always does
+        const bool improved = currentValue == std::numeric_limits<double>::infinity() || bestValue < currentValue - std::abs(currentValue) * minImprovement;
+        if (bestNeighbour == current || !improved) {
+            break;
+        }
+        current = bestNeighbour;
+        currentValue = bestValue;
+    }
+}
+
+const LaunchParameterSearch::Evaluation *LaunchParameterSearch::evaluate(GridIndex index, const Objective &objective) {
+    if (const auto it = evaluatedIndices.find(index); it != evaluatedIndices.end()) {
+        return &evaluations[it->second];
+    }
+    if (isPruned(index) || evaluations.size() >= maxEvaluations) {
+        return nullptr;
+    }
+
+    Evaluation evaluation{{workgroupSizes[index.first], workgroupCounts[index.second]}, false, 0};
+    evaluation.feasible = objective(evaluation.point, evaluation.value);
+    if (!evaluation.feasible) {
+        infeasibleIndices.push_back(index);
+    }
+    evaluatedIndices[index] = evaluations.size();
+    evaluations.push_back(evaluation);
+    return &evaluations.back();
+}
+
+bool LaunchParameterSearch::isPruned(GridIndex index) const {
+    for (const GridIndex &infeasible : infeasibleIndices) {
+        if (index.first >= infeasible.first && index.second >= infeasible.second) {
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t LaunchParameterSearch::getClosestIndex(const std::vector<size_t> &values, size_t value) {
+    size_t closestIndex = 0;
+    for (size_t index = 1; index < values.size(); index++) {
+        const auto distance = [value](size_t candidate) { return candidate > value ? candidate - value : value - candidate; };
+        if (distance(values[index]) < distance(values[closestIndex])) {
+            closestIndex = index;
+        }
+    }
+    return closestIndex;
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <utility>
+#include <vector>
+
+// Searches a grid of workgroup sizes and counts for the point with the lowest value of an objective, e.g. time of a
+// kernel. The grid is explored with hill climbing, which moves to the best of the eight neighbouring points while it
+// improves the objective by more than a relative threshold, so noise of measurements does not drive the search. Climbs
+// are restarted from the centers of grid quadrants until the limit of evaluations is reached, to escape local minima.
+// Limits of devices only bound workgroup sizes and counts from above, so a point which cannot be run prunes all points
+// with both size and count not smaller. The search does not depend on the framework, the objective is any function.
+class LaunchParameterSearch {
+  public:
+    struct Point {
+        size_t workgroupSize;
+        size_t workgroupCount;
+    };
+    struct Evaluation {
+        Point point;
+        bool feasible;
+        double value;
+    };
+
+    // Returns false if the point cannot be run, otherwise sets the value to minimize
+    using Objective = std::function<bool(const Point &point, double &value)>;
+
+    LaunchParameterSearch(const std::vector<size_t> &workgroupSizes, const std::vector<size_t> &workgroupCounts);
+    void setMaxEvaluations(size_t value) { maxEvaluations = value; }
+    void setMinImprovement(double value) { minImprovement = value; }
+
+    // Returns false if no feasible point was found
+    bool search(const Point &start, const Objective &objective);
+    const std::vector<Evaluation> &getEvaluations() const { return evaluations; }
+    const Evaluation &getBest() const { return evaluations[bestEvaluation]; }
+
+    static std::vector<size_t> getPowersOfTwo(size_t min, size_t max);
+
+  private:
+    using GridIndex = std::pair<size_t, size_t>;
+
+    void climb(GridIndex start, const Objective &objective);
+    const Evaluation *evaluate(GridIndex index, const Objective &objective);
+    bool isPruned(GridIndex index) const;
+    static size_t getClosestIndex(const std::vector<size_t> &values, size_t value);
+
+    const std::vector<size_t> workgroupSizes;
+    const std::vector<size_t> workgroupCounts;
+    size_t maxEvaluations = 40;
+    double minImprovement = 0.01;
+
+    std::vector<Evaluation> evaluations = {};
+    std::map<GridIndex, size_t> evaluatedIndices = {};
+    std::vector<GridIndex> infeasibleIndices = {};
+    size_t bestEvaluation = 0;
+};
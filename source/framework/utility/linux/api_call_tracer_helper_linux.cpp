@@ -0,0 +1,29 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/api_call_tracer_helper.h"
+
+#include <dlfcn.h>
+
+template <typename FunctionT>
+static FunctionT findTracerFunction(const char *symbol) {
+    return reinterpret_cast<FunctionT>(dlsym(RTLD_DEFAULT, symbol));
+}
+
+void ApiCallTracerHelper::notifyTestBegin(const std::string &testCaseNameWithConfig) {
+    static const auto testBegin = findTracerFunction<TestBeginFunction>(testBeginSymbol);
+    if (testBegin != nullptr) {
+        testBegin(testCaseNameWithConfig.c_str());
+    }
+}
+
+void ApiCallTracerHelper::notifyTestEnd() {
+    static const auto testEnd = findTracerFunction<TestEndFunction>(testEndSymbol);
+    if (testEnd != nullptr) {
+        testEnd();
+    }
+}
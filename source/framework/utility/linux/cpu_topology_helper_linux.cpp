@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/cpu_topology_helper.h"
+#include "framework/utility/error.h"
+#include "framework/utility/linux/error.h"
+
+#include <fstream>
+#include <pthread.h>
+#include <sched.h>
+#include <string>
+
+static size_t readTopologyValue(const std::string &path, size_t defaultValue) {
+    std::ifstream file{path};
+    size_t value = defaultValue;
+    if (file.good()) {
+        file >> value;
+    }
+    return file.fail() ? defaultValue : value;
+}
+
+std::vector<CpuTopologyHelper::CpuInfo> CpuTopologyHelper::getAvailableCpus() {
+    cpu_set_t cpuSet{};
+    FATAL_ERROR_IF_SYS_CALL_FAILED(sched_getaffinity(0, sizeof(cpuSet), &cpuSet), "sched_getaffinity failed");
+
+    std::vector<CpuInfo> result = {};
+    for (size_t cpuIndex = 0; cpuIndex < CPU_SETSIZE; cpuIndex++) {
+        if (!CPU_ISSET(cpuIndex, &cpuSet)) {
+            continue;
+        }
+
+        // Last level cache domain is identified by the lowest CPU sharing the L3. The shared_cpu_list
+        // file starts with that CPU, e.g. "0-7,64-71". If there is no L3, fall back to the socket.
+        const std::string cpuDirectory = "/sys/devices/system/cpu/cpu" + std::to_string(cpuIndex);
+        const size_t packageId = readTopologyValue(cpuDirectory + "/topology/physical_package_id", 0);
+        const size_t l3DomainId = readTopologyValue(cpuDirectory + "/cache/index3/shared_cpu_list", packageId);
+        result.push_back({cpuIndex, packageId, l3DomainId});
+    }
+    return result;
+}
+
+bool CpuTopologyHelper::pinCurrentThread(size_t cpuIndex) {
+    cpu_set_t cpuSet{};
+    CPU_ZERO(&cpuSet);
+    CPU_SET(cpuIndex, &cpuSet);
+    return pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet) == 0;
+}
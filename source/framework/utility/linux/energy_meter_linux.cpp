@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/energy_meter.h"
+#include "framework/utility/error.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+constexpr static const char *powercapPath = "/sys/class/powercap";
+
+template <typename T>
+static bool readValue(const std::filesystem::path &path, T &value) {
+    std::ifstream file{path};
+    file >> value;
+    return !file.fail();
+}
+
+std::vector<EnergyMeter::Domain> EnergyMeter::discoverDomains() {
+    // Zones are named intel-rapl:<package> with subzones intel-rapl:<package>:<index>, also on AMD CPUs. Only package
+    // and DRAM zones are used, since core and uncore are already contained in the package.
+    std::vector<Domain> result{};
+    std::error_code error{};
+    for (const auto &entry : std::filesystem::directory_iterator(powercapPath, error)) {
+        const std::string zoneName = entry.path().filename().string();
+        if (zoneName.rfind("intel-rapl:", 0) != 0) {
+            continue;
+        }
+
+        std::string name{};
+        uint64_t maxEnergyRange{};
+        uint64_t energy{};
+        if (!readValue(entry.path() / "name", name) ||
+            !readValue(entry.path() / "max_energy_range_uj", maxEnergyRange) ||
+            !readValue(entry.path() / "energy_uj", energy)) {
+            continue;
+        }
+        if (name.rfind("package", 0) != 0 && name != "dram") {
+            continue;
+        }
+
+        // DRAM zones are not unique across packages, so name them after the parent zone
+        if (name == "dram") {
+            std::string packageName{};
+            const std::string parentZone = zoneName.substr(0, zoneName.rfind(':'));
+            if (readValue(std::filesystem::path(powercapPath) / parentZone / "name", packageName)) {
+                name = packageName + "-dram";
+            }
+        }
+        result.push_back(Domain{name, (entry.path() / "energy_uj").string(), maxEnergyRange});
+    }
+
+    std::sort(result.begin(), result.end(), [](const Domain &a, const Domain &b) { return a.name < b.name; });
+    return result;
+}
+
+EnergyMeter::Counters EnergyMeter::readCounters() {
+    const auto &domains = getDomains();
+    Counters result(domains.size());
+    for (auto domainIndex = 0u; domainIndex < domains.size(); domainIndex++) {
+        FATAL_ERROR_IF(!readValue(domains[domainIndex].energyCounterPath, result[domainIndex]), "Could not read ", domains[domainIndex].energyCounterPath);
+    }
+    return result;
+}
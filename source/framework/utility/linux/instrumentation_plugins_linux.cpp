@@ -0,0 +1,22 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/instrumentation_plugins.h"
+
+#include <dlfcn.h>
+
+void *InstrumentationPlugins::openLibrary(const std::string &path, std::string &error) {
+    void *library = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (library == nullptr) {
+        error = dlerror();
+    }
+    return library;
+}
+
+void *InstrumentationPlugins::findSymbol(void *library, const char *symbol) {
+    return dlsym(library, symbol);
+}
@@ -0,0 +1,38 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/journal_file.h"
+
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+
+JournalFile::JournalFile(const std::string &filePath) {
+    handle = open(filePath.c_str(), O_WRONLY | O_APPEND | O_CREAT | O_CLOEXEC, 0644);
+}
+
+JournalFile::~JournalFile() {
+    if (isValid()) {
+        close(static_cast<int>(handle));
+    }
+}
+
+bool JournalFile::append(const std::string &data) {
+    const int fd = static_cast<int>(handle);
+    size_t bytesWritten = 0;
+    while (bytesWritten < data.size()) {
+        const ssize_t result = write(fd, data.data() + bytesWritten, data.size() - bytesWritten);
+        if (result == -1 && errno == EINTR) {
+            continue;
+        }
+        if (result <= 0) {
+            return false;
+        }
+        bytesWritten += static_cast<size_t>(result);
+    }
+    return fsync(fd) == 0;
+}
@@ -0,0 +1,38 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/mapped_file.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+MappedFile::MappedFile(const std::string &filePath) {
+    const int fd = open(filePath.c_str(), O_RDONLY);
+    if (fd == -1) {
+        return;
+    }
+
+    struct stat fileStatus {};
+    if (fstat(fd, &fileStatus) == 0 && fileStatus.st_size > 0) {
+        void *mapping = mmap(nullptr, static_cast<size_t>(fileStatus.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping != MAP_FAILED) {
+            data = static_cast<const uint8_t *>(mapping);
+            size = static_cast<size_t>(fileStatus.st_size);
+        }
+    }
+
+    // The mapping stays valid after closing the descriptor
+    close(fd);
+}
+
+MappedFile::~MappedFile() {
+    if (data != nullptr) {
+        munmap(const_cast<uint8_t *>(data), size);
+    }
+}
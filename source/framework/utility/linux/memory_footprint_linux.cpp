@@ -0,0 +1,45 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/memory_footprint.h"
+
+#include <fstream>
+#include <string>
+#include <sys/resource.h>
+
+// Reads "Key:   <value> kB" entries from /proc files
+static int64_t readProcValue(const char *path, const std::string &key) {
+    std::ifstream file{path};
+    std::string line{};
+    while (std::getline(file, line)) {
+        if (line.compare(0, key.size(), key) == 0 && line.size() > key.size() && line[key.size()] == ':') {
+            return std::stoll(line.substr(key.size() + 1));
+        }
+    }
+    return 0;
+}
+
+MemoryFootprint MemoryFootprint::capture() {
+    MemoryFootprint result{};
+
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+        result.minorPageFaults = usage.ru_minflt;
+        result.majorPageFaults = usage.ru_majflt;
+    }
+
+    result.residentKilobytes = readProcValue("/proc/self/smaps_rollup", "Rss");
+    result.anonymousKilobytes = readProcValue("/proc/self/smaps_rollup", "Anonymous");
+    result.peakResidentKilobytes = readProcValue("/proc/self/status", "VmHWM");
+    return result;
+}
+
+void MemoryFootprint::resetPeakResident() {
+    // Writing 5 to clear_refs resets VmHWM to the current RSS. If it fails, peak of the whole process is reported.
+    std::ofstream file{"/proc/self/clear_refs"};
+    file << "5";
+}
@@ -10,8 +10,12 @@
 #include "framework/utility/process.h"
 #include "framework/utility/process_synchronization_helper.h"
 
+#include <algorithm>
+#include <cerrno>
 #include <fcntl.h>
 #include <memory>
+#include <poll.h>
+#include <signal.h>
 #include <sstream>
 #include <sys/types.h>
 #include <sys/wait.h>
@@ -75,9 +79,11 @@ void Process::run() {
         FATAL_ERROR_IF_SYS_CALL_FAILED(close(processDataLinux->stdOutPipe.read), "closing pipe failed");
 
         // Below pipe endpoints will be explicitly used by the child workload and they should be closed by it.
-        this->addArgument("synchronizationPipeIn", std::to_string(processDataLinux->synchronizationPipeParentToChild.read));
-        this->addArgument("synchronizationPipeOut", std::to_string(processDataLinux->synchronizationPipeChildToParent.write));
-        this->addArgument("measurementPipe", std::to_string(processDataLinux->measurementPipe.write));
+        if (this->passPipesAsArguments) {
+            this->addArgument("synchronizationPipeIn", std::to_string(processDataLinux->synchronizationPipeParentToChild.read));
+            this->addArgument("synchronizationPipeOut", std::to_string(processDataLinux->synchronizationPipeChildToParent.write));
+            this->addArgument("measurementPipe", std::to_string(processDataLinux->measurementPipe.write));
+        }
 
         // Prepare arguments
         std::vector<std::string> argumentsForExecStrings = {};
@@ -127,31 +133,87 @@ void Process::freeOsSpecificData() {
     FATAL_ERROR_IF_SYS_CALL_FAILED(close(processDataLinux->synchronizationPipeParentToChild.write), "closing pipe failed");
     FATAL_ERROR_IF_SYS_CALL_FAILED(close(processDataLinux->synchronizationPipeChildToParent.read), "closing pipe failed");
     FATAL_ERROR_IF_SYS_CALL_FAILED(close(processDataLinux->measurementPipe.read), "closing pipe failed");
+    FATAL_ERROR_IF_SYS_CALL_FAILED(close(processDataLinux->stdOutPipe.read), "closing pipe failed");
 
     delete processDataLinux;
 }
 
+static bool checkChildStatus(ProcessDataLinux &processDataLinux, int waitOptions) {
+    int status{};
+    int pid = waitpid(processDataLinux.childPid, &status, waitOptions);
+    FATAL_ERROR_IF(pid == -1, std::string("waitpid() returned an error, ") + getErrorFromErrno());
+    if (pid == 0) {
+        return false; // WNOHANG was passed and the child is still running
+    }
+    FATAL_ERROR_IF(pid != processDataLinux.childPid, "waitpid() signalled from wrong child process");
+    FATAL_ERROR_IF(WIFSTOPPED(status), "child process stopped by signal")
+
+    if (WIFSIGNALED(status)) {
+        processDataLinux.result = TestResult::Crash;
+    } else if (WIFEXITED(status)) {
+        processDataLinux.result = static_cast<TestResult>(WEXITSTATUS(status));
+    } else {
+        return false;
+    }
+    processDataLinux.ended = true;
+    return true;
+}
+
 void Process::waitForFinish() {
-    ProcessDataLinux *processDataLinux = static_cast<ProcessDataLinux *>(this->osSpecificData);
-    if (processDataLinux->ended) {
+    waitForFinish(std::chrono::milliseconds::max());
+}
+
+static void drainPipe(const pollfd &pipePoll, std::string &output, bool &open) {
+    if ((pipePoll.revents & (POLLIN | POLLHUP)) == 0) {
         return;
     }
+    char buffer[1024];
+    const ssize_t numberOfBytesRead = read(pipePoll.fd, buffer, sizeof(buffer));
+    FATAL_ERROR_IF_SYS_CALL_FAILED(numberOfBytesRead, "reading a child process pipe failed");
+    output.append(buffer, static_cast<size_t>(numberOfBytesRead));
+    open = numberOfBytesRead > 0;
+}
 
-    while (true) {
-        int status{};
-        int pid = waitpid(processDataLinux->childPid, &status, 0);
-        FATAL_ERROR_IF(pid == -1, std::string("waitpid() returned an error, ") + getErrorFromErrno());
-        FATAL_ERROR_IF(pid != processDataLinux->childPid, "waitpid() signalled from wrong child process");
-        FATAL_ERROR_IF(WIFSIGNALED(status), "child process killed by signal")
-        FATAL_ERROR_IF(WIFSTOPPED(status), "child process stopped by signal")
-
-        if (WIFEXITED(status)) {
-            processDataLinux->result = static_cast<TestResult>(WEXITSTATUS(status));
-            break;
+bool Process::waitForFinish(std::chrono::milliseconds timeout) {
+    ProcessDataLinux *processDataLinux = static_cast<ProcessDataLinux *>(this->osSpecificData);
+    const bool hasTimeout = timeout != std::chrono::milliseconds::max();
+    const auto start = std::chrono::steady_clock::now();
+    bool stdOutOpen = !processDataLinux->hasStdOut;
+    bool measurementsOpen = !processDataLinux->hasMeasurements;
+
+    while (!processDataLinux->ended && !checkChildStatus(*processDataLinux, WNOHANG)) {
+        int pollTimeout = 10;
+        if (hasTimeout) {
+            const auto timeLeft = timeout - std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+            if (timeLeft.count() <= 0) {
+                return false;
+            }
+            pollTimeout = static_cast<int>(std::min<std::chrono::milliseconds::rep>(timeLeft.count(), pollTimeout));
         }
+
+        // Drain stdout and measurements while waiting, a child blocked on a full pipe would never finish
+        pollfd pipePolls[] = {
+            {stdOutOpen ? processDataLinux->stdOutPipe.read : -1, POLLIN, 0},
+            {measurementsOpen ? processDataLinux->measurementPipe.read : -1, POLLIN, 0},
+        };
+        const int pollResult = poll(pipePolls, 2, pollTimeout);
+        FATAL_ERROR_IF(pollResult == -1 && errno != EINTR, std::string("poll() returned an error, ") + getErrorFromErrno());
+        if (pollResult > 0) {
+            drainPipe(pipePolls[0], processDataLinux->stdOut, stdOutOpen);
+            drainPipe(pipePolls[1], processDataLinux->measurements, measurementsOpen);
+        }
+    }
+    return true;
+}
+
+void Process::terminate() {
+    ProcessDataLinux *processDataLinux = static_cast<ProcessDataLinux *>(this->osSpecificData);
+    if (processDataLinux->ended) {
+        return;
     }
 
-    processDataLinux->ended = true;
+    FATAL_ERROR_IF_SYS_CALL_FAILED(kill(processDataLinux->childPid, SIGKILL), "killing child process failed");
+    waitForFinish();
 }
 
 TestResult Process::getResult() {
@@ -183,7 +245,7 @@ const std::string &Process::getStdout() {
 
     if (!processDataLinux->hasStdOut) {
         waitForFinish();
-        processDataLinux->stdOut = readEntirePipe(processDataLinux->stdOutPipe);
+        processDataLinux->stdOut += readEntirePipe(processDataLinux->stdOutPipe);
         processDataLinux->hasStdOut = true;
     }
 
@@ -195,7 +257,7 @@ const std::string &Process::getMeasurements() {
 
     if (!processDataLinux->hasMeasurements) {
         waitForFinish();
-        processDataLinux->measurements = readEntirePipe(processDataLinux->measurementPipe);
+        processDataLinux->measurements += readEntirePipe(processDataLinux->measurementPipe);
         processDataLinux->hasMeasurements = true;
     }
 
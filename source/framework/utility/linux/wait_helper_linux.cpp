@@ -0,0 +1,26 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/wait_helper.h"
+
+#include <climits>
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+// Memory written by the GPU does not wake up futex waiters, so the sleep has to be bounded
+constexpr static long futexTimeoutNs = 50000;
+
+void WaitHelper::sleepOnAddress(const volatile uint32_t *address, uint32_t observedValue) {
+    const timespec timeout = {0, futexTimeoutNs};
+    syscall(SYS_futex, const_cast<uint32_t *>(address), FUTEX_WAIT_PRIVATE, observedValue, &timeout, nullptr, 0);
+}
+
+void WaitHelper::notify(const volatile void *address) {
+    syscall(SYS_futex, const_cast<void *>(address), FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+}
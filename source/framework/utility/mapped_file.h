@@ -0,0 +1,29 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Read-only memory mapping of a whole file. Large files can be accessed without reading them into memory first.
+class MappedFile {
+  public:
+    explicit MappedFile(const std::string &filePath);
+    ~MappedFile();
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    bool isValid() const { return data != nullptr; }
+    const uint8_t *getData() const { return data; }
+    size_t getSize() const { return size; }
+
+  private:
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+};
@@ -0,0 +1,23 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+
+// Host memory usage and page fault counters of the benchmark process. Captured before and after each test in
+// verbose mode, so memory hungry or leaking test configurations can be identified.
+struct MemoryFootprint {
+    int64_t residentKilobytes = 0;
+    int64_t peakResidentKilobytes = 0;
+    int64_t anonymousKilobytes = 0;
+    int64_t minorPageFaults = 0;
+    int64_t majorPageFaults = 0;
+
+    static MemoryFootprint capture();
+    static void resetPeakResident();
+};
@@ -9,6 +9,7 @@
 
 #include "framework/test_case/test_result.h"
 
+#include <chrono>
 #include <string>
 #include <vector>
 
@@ -24,6 +25,7 @@ class Process {
     void addEnvVariable(const std::string &key, const std::string &value);
     void addHandleForInheritance(int handle);
     void setName(const std::string &string) { this->processName = string; }
+    void setPassPipesAsArguments(bool value) { this->passPipesAsArguments = value; } // workloads expect pipes as arguments, other executables may reject them
 
     // Getters
     std::vector<uint64_t> getMeasurements(size_t expectedCount);
@@ -32,6 +34,8 @@ class Process {
     // OS-specific methods
     void run();
     void waitForFinish();
+    bool waitForFinish(std::chrono::milliseconds timeout); // returns false if process is still running after timeout, max() waits without a timeout
+    void terminate();                                      // process killed this way returns TestResult::Crash
     TestResult getResult();
     const std::string &getMeasurements();
     const std::string &getStdout();
@@ -47,4 +51,5 @@ class Process {
     std::vector<int> handlesForInheritance;
     void *osSpecificData = nullptr;
     std::string processName = "";
+    bool passPipesAsArguments = true;
 };
@@ -10,6 +10,7 @@
 #include "framework/utility/error.h"
 #include "framework/utility/statistics.h"
 #include "framework/utility/string_utils.h"
+#include "framework/utility/trace_recorder.h"
 
 ProcessGroup::ProcessGroup(const std::string &binaryName, size_t count)
     : binaryName(binaryName) {
@@ -31,8 +32,12 @@ void ProcessGroup::addEnvVariableAll(const std::string &key, const std::string &
 }
 
 void ProcessGroup::runAll() {
+    const bool traceEnabled = TraceRecorder::isEnabled();
     for (Process &process : processes) {
         process.run();
+        if (traceEnabled) {
+            traceIds.push_back(TraceRecorder::beginAsyncEvent(getTraceName(process), "process"));
+        }
     }
 }
 
@@ -49,9 +54,13 @@ void ProcessGroup::synchronizeAll(size_t iterationsCount) {
 }
 
 void ProcessGroup::waitForFinishAll() {
-    for (Process &process : processes) {
-        process.waitForFinish();
+    for (auto processIndex = 0u; processIndex < processes.size(); processIndex++) {
+        processes[processIndex].waitForFinish();
+        if (processIndex < traceIds.size()) {
+            TraceRecorder::endAsyncEvent(getTraceName(processes[processIndex]), "process", traceIds[processIndex]);
+        }
     }
+    traceIds.clear();
 }
 
 TestResult ProcessGroup::getResultAll() {
@@ -96,6 +105,10 @@ void ProcessGroup::pushMeasurementsToStatistics(size_t expectedCount,
     }
 }
 
+std::string ProcessGroup::getTraceName(const Process &process) const {
+    return process.getName().empty() ? binaryName : process.getName();
+}
+
 Process &ProcessGroup::operator[](size_t index) {
     FATAL_ERROR_IF(index >= processes.size(), "Invalid process index");
     return processes[index];
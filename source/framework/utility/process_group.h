@@ -40,6 +40,9 @@ class ProcessGroup {
     size_t size() const;
 
   private:
+    std::string getTraceName(const Process &process) const;
+
     const std::string binaryName;
     std::vector<Process> processes = {};
+    std::vector<uint64_t> traceIds = {};
 };
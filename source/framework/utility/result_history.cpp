@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "result_history.h"
+
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+bool ResultHistory::append(const std::string &filePath, const std::vector<ResultHistoryEntry> &entries) {
+    std::ostringstream lines{};
+    lines << std::setprecision(9);
+    for (const auto &entry : entries) {
+        lines << entry.unixTimeSeconds << '\t'
+              << sanitize(entry.benchmarkName) << '\t'
+              << sanitize(entry.benchmarkVersion) << '\t'
+              << sanitize(entry.configuration) << '\t'
+              << sanitize(entry.label) << '\t'
+              << sanitize(entry.type) << '\t'
+              << entry.mean << '\t'
+              << entry.median << '\t'
+              << entry.relativeStandardDeviation << '\t'
+              << entry.min << '\t'
+              << entry.max << '\t'
+              << entry.samplesCount << '\n';
+    }
+
+    std::ofstream file{filePath, std::ios::out | std::ios::app | std::ios::binary};
+    if (!file.good()) {
+        return false;
+    }
+    if (file.tellp() == 0) {
+        file << fileHeader << '\n';
+    }
+    const std::string content = lines.str();
+    file.write(content.data(), content.size());
+    file.flush();
+    return file.good();
+}
+
+bool ResultHistory::load(const std::string &filePath, std::vector<ResultHistoryEntry> &entries, std::string &error) {
+    std::ifstream file{filePath, std::ios::in | std::ios::binary};
+    if (!file.good()) {
+        error = "could not open the file";
+        return false;
+    }
+
+    std::string line{};
+    size_t lineNumber = 0;
+    while (std::getline(file, line)) {
+        lineNumber++;
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        std::vector<std::string> fields{};
+        std::istringstream lineStream{line};
+        for (std::string field{}; std::getline(lineStream, field, '\t');) {
+            fields.push_back(field);
+        }
+        if (fields.size() != 12) {
+            error = "invalid number of fields in line " + std::to_string(lineNumber);
+            return false;
+        }
+
+        ResultHistoryEntry entry{};
+        try {
+            entry.unixTimeSeconds = std::stoull(fields[0]);
+            entry.benchmarkName = fields[1];
+            entry.benchmarkVersion = fields[2];
+            entry.configuration = fields[3];
+            entry.label = fields[4];
+            entry.type = fields[5];
+            entry.mean = std::stod(fields[6]);
+            entry.median = std::stod(fields[7]);
+            entry.relativeStandardDeviation = std::stod(fields[8]);
+            entry.min = std::stod(fields[9]);
+            entry.max = std::stod(fields[10]);
+            entry.samplesCount = std::stoull(fields[11]);
+        } catch (const std::exception &) {
+            error = "invalid value in line " + std::to_string(lineNumber);
+            return false;
+        }
+        entries.push_back(std::move(entry));
+    }
+    return true;
+}
+
+std::string ResultHistory::sanitize(const std::string &field) {
+    std::string result = field;
+    for (char &character : result) {
+        if (character == '\t' || character == '\n' || character == '\r') {
+            character = ' ';
+        }
+    }
+    return result;
+}
@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Append-only store of benchmark results, written with --history and queried with tools/result_history. Each
+// line of the file is one sample group of one test configuration from one run, as tab-separated fields in the
+// order of ResultHistoryEntry. Runs of different benchmarks and versions can share a file, so results of a host can
+// be tracked over time without any database. Lines are written with single appends, so concurrent benchmarks do not
+// interleave them.
+struct ResultHistoryEntry {
+    uint64_t unixTimeSeconds = 0;
+    std::string benchmarkName = {};
+    std::string benchmarkVersion = {};
+    std::string configuration = {};
+    std::string label = {};
+    std::string type = {};
+    double mean = 0;
+    double median = 0;
+    double relativeStandardDeviation = 0;
+    double min = 0;
+    double max = 0;
+    uint64_t samplesCount = 0;
+
+    std::string getSeriesKey() const { return benchmarkName + ' ' + configuration + ' ' + label; }
+};
+
+struct ResultHistory {
+    static constexpr const char *fileHeader = "#compute-benchmarks-history\t1";
+
+    static bool append(const std::string &filePath, const std::vector<ResultHistoryEntry> &entries);
+    static bool load(const std::string &filePath, std::vector<ResultHistoryEntry> &entries, std::string &error);
+
+  private:
+    static std::string sanitize(const std::string &field);
+};
@@ -0,0 +1,38 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+
+// Layout of files written with --dumpSamples. Every file contains all samples of one test configuration in the
+// order they were pushed. It is meant to be memory-mapped, so all arrays are 8-byte aligned and stored
+// little-endian:
+//
+//     SampleDumpHeader
+//     uint64_t timestamps[sampleCount]   nanoseconds since the start of the test, taken when the sample was pushed
+//     double values[sampleCount]         measured value (duration, bandwidth, ...) in the unit of the channel
+//     uint32_t channelIds[sampleCount]   index of the channel the sample belongs to
+//     char strings[stringsSize]          null-terminated test name, then label and type of each channel
+//
+// A channel corresponds to one line of the regular output, e.g. the main result or an energy group.
+struct SampleDumpHeader {
+    static constexpr char expectedMagic[8] = {'C', 'B', 'S', 'A', 'M', 'P', 'L', 'E'};
+    static constexpr uint32_t currentVersion = 1;
+
+    char magic[8];
+    uint32_t version;
+    uint32_t channelCount;
+    uint64_t sampleCount;
+    uint64_t startTimeUnixNanoseconds;
+    uint64_t timestampsOffset;
+    uint64_t valuesOffset;
+    uint64_t channelIdsOffset;
+    uint64_t stringsOffset;
+    uint64_t stringsSize;
+};
+static_assert(sizeof(SampleDumpHeader) % 8 == 0, "Arrays following the header must be aligned");
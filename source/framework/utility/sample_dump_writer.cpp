@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "sample_dump_writer.h"
+
+#include "framework/utility/error.h"
+#include "framework/utility/sample_dump_format.h"
+
+#include <cctype>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <sstream>
+
+std::string SampleDump::getFilePath(const std::string &directory, const std::string &testCaseName) {
+    // Test names with all arguments can be too long for a file name and contain characters not allowed in
+    // it, so use a readable prefix and make it unique with a hash. The full name is stored inside the file.
+    constexpr size_t maxPrefixLength = 100;
+    std::string prefix = testCaseName.substr(0, maxPrefixLength);
+    for (char &character : prefix) {
+        if (!std::isalnum(static_cast<unsigned char>(character))) {
+            character = '_';
+        }
+    }
+
+    std::ostringstream fileName{};
+    fileName << prefix << '_' << std::hex << std::setw(16) << std::setfill('0') << std::hash<std::string>{}(testCaseName) << ".samples";
+    return (std::filesystem::path(directory) / fileName.str()).string();
+}
+
+bool SampleDump::writeToFile(const std::string &filePath) const {
+    const uint16_t endiannessProbe = 1;
+    FATAL_ERROR_IF(*reinterpret_cast<const uint8_t *>(&endiannessProbe) != 1, "Sample dumps are supported only on little-endian hosts");
+    FATAL_ERROR_IF(timestamps.size() != values.size() || values.size() != channelIds.size(), "Inconsistent sample dump");
+
+    std::string strings = testCaseName + '\0';
+    for (const auto &channel : channels) {
+        strings += channel.label + '\0' + channel.type + '\0';
+    }
+
+    const uint64_t sampleCount = values.size();
+    SampleDumpHeader header{};
+    std::memcpy(header.magic, SampleDumpHeader::expectedMagic, sizeof(header.magic));
+    header.version = SampleDumpHeader::currentVersion;
+    header.channelCount = static_cast<uint32_t>(channels.size());
+    header.sampleCount = sampleCount;
+    header.startTimeUnixNanoseconds = startTimeUnixNanoseconds;
+    header.timestampsOffset = sizeof(SampleDumpHeader);
+    header.valuesOffset = header.timestampsOffset + sampleCount * sizeof(uint64_t);
+    header.channelIdsOffset = header.valuesOffset + sampleCount * sizeof(double);
+    header.stringsOffset = header.channelIdsOffset + sampleCount * sizeof(uint32_t);
+    header.stringsSize = strings.size();
+
+    // Channel ids are 4 bytes each, pad them so the strings start at an aligned offset as well
+    const uint64_t channelIdsPadding = (8 - header.stringsOffset % 8) % 8;
+    header.stringsOffset += channelIdsPadding;
+
+    std::error_code error{};
+    std::filesystem::create_directories(std::filesystem::path(filePath).parent_path(), error);
+    std::ofstream file{filePath, std::ios::out | std::ios::binary | std::ios::trunc};
+    if (!file.good()) {
+        return false;
+    }
+    const char padding[8] = {};
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char *>(timestamps.data()), sampleCount * sizeof(uint64_t));
+    file.write(reinterpret_cast<const char *>(values.data()), sampleCount * sizeof(double));
+    file.write(reinterpret_cast<const char *>(channelIds.data()), sampleCount * sizeof(uint32_t));
+    file.write(padding, channelIdsPadding);
+    file.write(strings.data(), strings.size());
+    return file.good();
+}
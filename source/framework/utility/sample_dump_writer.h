@@ -0,0 +1,31 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Collected samples of a single test configuration, written to a file in the format described in
+// sample_dump_format.h. Can be read with tools/sample_dump_reader.
+struct SampleDump {
+    struct Channel {
+        std::string label;
+        std::string type;
+    };
+
+    std::string testCaseName = {};
+    uint64_t startTimeUnixNanoseconds = 0;
+    std::vector<Channel> channels = {};
+    std::vector<uint64_t> timestamps = {};
+    std::vector<double> values = {};
+    std::vector<uint32_t> channelIds = {};
+
+    static std::string getFilePath(const std::string &directory, const std::string &testCaseName);
+    bool writeToFile(const std::string &filePath) const;
+};
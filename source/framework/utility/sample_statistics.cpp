@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "sample_statistics.h"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <numeric>
+
+double SampleStatistics::getMean(const std::vector<double> &samples) {
+    if (samples.empty()) {
+        return 0;
+    }
+    return std::accumulate(samples.begin(), samples.end(), 0.0) / static_cast<double>(samples.size());
+}
+
+double SampleStatistics::getStudentTQuantile(size_t degreesOfFreedom) {
+    // Larger degrees of freedom use the first terms of the expansion around the normal quantile, which is accurate
+    // to 0.1% there
+    const static double quantiles[] = {12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+                                       2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+                                       2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+    if (degreesOfFreedom == 0) {
+        return std::numeric_limits<double>::infinity();
+    }
+    if (degreesOfFreedom <= std::size(quantiles)) {
+        return quantiles[degreesOfFreedom - 1];
+    }
+    const double z = 1.959964;
+    return z + (z * z * z + z) / (4 * static_cast<double>(degreesOfFreedom));
+}
+
+SampleStatistics::OneWayAnova SampleStatistics::getOneWayAnova(const std::vector<std::vector<double>> &groups) {
+    OneWayAnova result{};
+    size_t samplesCount = 0;
+    size_t sumOfSquaredGroupSizes = 0;
+    double sum = 0;
+    for (const auto &group : groups) {
+        samplesCount += group.size();
+        sumOfSquaredGroupSizes += group.size() * group.size();
+        sum += std::accumulate(group.begin(), group.end(), 0.0);
+    }
+    if (groups.size() < 2 || samplesCount <= groups.size()) {
+        result.grandMean = samplesCount > 0 ? sum / static_cast<double>(samplesCount) : 0;
+        return result;
+    }
+    result.grandMean = sum / static_cast<double>(samplesCount);
+
+    double sumOfSquaresBetween = 0;
+    double sumOfSquaresWithin = 0;
+    for (const auto &group : groups) {
+        const double groupMean = getMean(group);
+        sumOfSquaresBetween += static_cast<double>(group.size()) * (groupMean - result.grandMean) * (groupMean - result.grandMean);
+        for (const double sample : group) {
+            sumOfSquaresWithin += (sample - groupMean) * (sample - groupMean);
+        }
+    }
+    result.betweenDegreesOfFreedom = groups.size() - 1;
+    result.withinDegreesOfFreedom = samplesCount - groups.size();
+    const double meanSquareBetween = sumOfSquaresBetween / static_cast<double>(result.betweenDegreesOfFreedom);
+    const double meanSquareWithin = sumOfSquaresWithin / static_cast<double>(result.withinDegreesOfFreedom);
+
+    // Groups of unequal sizes use the effective group size of the unbalanced design
+    const double effectiveGroupSize = (static_cast<double>(samplesCount) - static_cast<double>(sumOfSquaredGroupSizes) / static_cast<double>(samplesCount)) /
+                                      static_cast<double>(result.betweenDegreesOfFreedom);
+    result.withinVariance = meanSquareWithin;
+    result.betweenVariance = std::max(0.0, (meanSquareBetween - meanSquareWithin) / effectiveGroupSize);
+    result.fStatistic = meanSquareWithin > 0 ? meanSquareBetween / meanSquareWithin : std::numeric_limits<double>::infinity();
+    return result;
+}
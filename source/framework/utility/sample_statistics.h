@@ -0,0 +1,29 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+// Statistics over groups of samples from separate runs of a test, used by modes comparing such runs
+struct SampleStatistics {
+    // Breakdown of variance of samples grouped by the run they come from. Between-run variance is the variance
+    // component of run means, i.e. their variance beyond what the within-run variance alone would cause.
+    struct OneWayAnova {
+        double grandMean = 0;
+        double withinVariance = 0;
+        double betweenVariance = 0;
+        double fStatistic = 0;
+        size_t betweenDegreesOfFreedom = 0;
+        size_t withinDegreesOfFreedom = 0;
+    };
+
+    static double getMean(const std::vector<double> &samples);
+    static double getStudentTQuantile(size_t degreesOfFreedom); // two-sided, 95% confidence
+    static OneWayAnova getOneWayAnova(const std::vector<std::vector<double>> &groups);
+};
@@ -64,6 +64,21 @@ inline std::vector<std::string> splitString(const std::string &string) {
     return result;
 }
 
+inline std::vector<std::string> splitString(const std::string &string, char separator) {
+    std::vector<std::string> result = {};
+    std::istringstream stringStream(string);
+
+    std::string token{};
+    while (std::getline(stringStream, token, separator)) {
+        result.push_back(token);
+    }
+    if (!string.empty() && string.back() == separator) {
+        result.push_back("");
+    }
+
+    return result;
+}
+
 inline std::pair<std::string_view, bool> handleFilterNegation(std::string_view string) {
     bool negated = false;
     while (!string.empty() && string.front() == '^') {
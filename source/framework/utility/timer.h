@@ -9,6 +9,9 @@
 #include <chrono>
 #include <cstdio>
 #include <framework/configuration.h>
+#include <framework/utility/energy_meter.h>
+#include <framework/utility/instrumentation_plugins.h>
+#include <framework/utility/trace_recorder.h>
 #if defined(__ARM_ARCH)
 #include <sse2neon.h>
 #else
@@ -21,6 +24,9 @@ class Timer {
         if (Configuration::get().markTimers) {
             markTimers = true;
         }
+        traceEnabled = TraceRecorder::isEnabled();
+        energyEnabled = EnergyMeter::isEnabled();
+        pluginsEnabled = InstrumentationPlugins::isAnyLoaded();
     }
     using Clock = std::chrono::high_resolution_clock;
 
@@ -28,6 +34,12 @@ class Timer {
         if (this->markTimers) {
             printf("\n Timer START \n");
         }
+        if (this->energyEnabled) {
+            EnergyMeter::beginTimedRegion();
+        }
+        if (this->pluginsEnabled) {
+            InstrumentationPlugins::notifyIterationBegin();
+        }
         // make sure that any pending instructions are done and all memory transactions committed.
         _mm_mfence();
         _mm_lfence();
@@ -42,6 +54,15 @@ class Timer {
         if (this->markTimers) {
             printf("\n Timer END \n");
         }
+        if (this->pluginsEnabled) {
+            InstrumentationPlugins::notifyIterationEnd(std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime));
+        }
+        if (this->energyEnabled) {
+            EnergyMeter::endTimedRegion();
+        }
+        if (this->traceEnabled) {
+            TraceRecorder::addCompleteEvent("Timer", "measurement", startTime, endTime);
+        }
     }
 
     Clock::duration get() const {
@@ -50,6 +71,9 @@ class Timer {
 
   private:
     bool markTimers = false;
+    bool traceEnabled = false;
+    bool energyEnabled = false;
+    bool pluginsEnabled = false;
     Clock::time_point startTime;
     Clock::time_point endTime;
 };
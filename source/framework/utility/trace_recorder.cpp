@@ -0,0 +1,152 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "trace_recorder.h"
+
+#include "framework/configuration.h"
+#include "framework/utility/error.h"
+
+#include <atomic>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+namespace {
+struct TraceEvent {
+    std::string name;
+    const char *category;
+    char phase;
+    TraceRecorder::Clock::time_point timestamp;
+    TraceRecorder::Clock::duration duration;
+    uint64_t id;
+};
+
+struct ThreadBuffer {
+    size_t threadIndex;
+    std::mutex mutex;
+    std::vector<TraceEvent> events;
+};
+
+// Buffers are shared with the global list, so that events of threads which have already exited are not lost
+struct TraceState {
+    std::mutex mutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> threadBuffers;
+    std::atomic<uint64_t> nextAsyncId{0};
+    std::ofstream file;
+    bool fileOpened = false;
+};
+
+TraceState &getState() {
+    static TraceState state{};
+    return state;
+}
+
+ThreadBuffer &getThreadBuffer() {
+    thread_local std::shared_ptr<ThreadBuffer> buffer = []() {
+        TraceState &state = getState();
+        std::lock_guard<std::mutex> lock{state.mutex};
+        auto newBuffer = std::make_shared<ThreadBuffer>();
+        newBuffer->threadIndex = state.threadBuffers.size();
+        state.threadBuffers.push_back(newBuffer);
+        return newBuffer;
+    }();
+    return *buffer;
+}
+
+void addEvent(TraceEvent &&event) {
+    ThreadBuffer &buffer = getThreadBuffer();
+    std::lock_guard<std::mutex> lock{buffer.mutex};
+    buffer.events.push_back(std::move(event));
+}
+
+std::string escapeJsonString(const std::string &value) {
+    std::ostringstream result{};
+    for (char character : value) {
+        switch (character) {
+        case '"':
+            result << "\\\"";
+            break;
+        case '\\':
+            result << "\\\\";
+            break;
+        default:
+            // JSON does not allow raw control characters in strings
+            if (static_cast<unsigned char>(character) < 0x20) {
+                result << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(character) << std::dec << std::setfill(' ');
+            } else {
+                result << character;
+            }
+        }
+    }
+    return result.str();
+}
+
+double toMicroseconds(TraceRecorder::Clock::duration duration) {
+    return std::chrono::duration<double, std::micro>(duration).count();
+}
+} // namespace
+
+bool TraceRecorder::isEnabled() {
+    return !static_cast<const std::string &>(Configuration::get().trace).empty();
+}
+
+void TraceRecorder::addCompleteEvent(const std::string &name, const char *category, Clock::time_point start, Clock::time_point end) {
+    addEvent(TraceEvent{name, category, 'X', start, end - start, 0});
+}
+
+uint64_t TraceRecorder::beginAsyncEvent(const std::string &name, const char *category) {
+    const uint64_t id = getState().nextAsyncId++;
+    addEvent(TraceEvent{name, category, 'b', Clock::now(), {}, id});
+    return id;
+}
+
+void TraceRecorder::endAsyncEvent(const std::string &name, const char *category, uint64_t id) {
+    addEvent(TraceEvent{name, category, 'e', Clock::now(), {}, id});
+}
+
+void TraceRecorder::flush() {
+    if (!isEnabled()) {
+        return;
+    }
+
+    TraceState &state = getState();
+    std::lock_guard<std::mutex> lock{state.mutex};
+
+    // The file is written in JSON array format without the closing bracket, which is allowed by the trace
+    // viewers. This way it stays valid after every flush, also when the benchmark crashes later on.
+    if (!state.fileOpened) {
+        const std::string &fileName = Configuration::get().trace;
+        state.file.open(fileName, std::ios::out | std::ios::trunc);
+        FATAL_ERROR_IF(!state.file.good(), "Could not open trace file ", fileName);
+        state.file << "[\n";
+        state.fileOpened = true;
+    }
+
+    for (auto &buffer : state.threadBuffers) {
+        std::lock_guard<std::mutex> bufferLock{buffer->mutex};
+        for (const TraceEvent &event : buffer->events) {
+            state.file << std::fixed << std::setprecision(3)
+                       << "{\"name\":\"" << escapeJsonString(event.name) << "\""
+                       << ",\"cat\":\"" << event.category << "\""
+                       << ",\"ph\":\"" << event.phase << "\""
+                       << ",\"ts\":" << toMicroseconds(event.timestamp.time_since_epoch())
+                       << ",\"pid\":0"
+                       << ",\"tid\":" << buffer->threadIndex;
+            if (event.phase == 'X') {
+                state.file << ",\"dur\":" << toMicroseconds(event.duration);
+            } else {
+                state.file << ",\"id\":" << event.id;
+            }
+            state.file << "},\n";
+        }
+        buffer->events.clear();
+    }
+    state.file.flush();
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+// Records spans of benchmark execution in Chrome trace-event format, which can be opened in chrome://tracing or
+// ui.perfetto.dev. Events are appended to a buffer owned by the calling thread and written to the file given with
+// --trace by flush(), which is called after each test. Timestamps come from the same clock as Timer, so
+// the spans line up with measured iterations.
+class TraceRecorder {
+  public:
+    using Clock = std::chrono::high_resolution_clock;
+
+    static bool isEnabled();
+
+    static void addCompleteEvent(const std::string &name, const char *category, Clock::time_point start, Clock::time_point end);
+    static uint64_t beginAsyncEvent(const std::string &name, const char *category);
+    static void endAsyncEvent(const std::string &name, const char *category, uint64_t id);
+
+    static void flush();
+};
+
+// Adds a complete event spanning the lifetime of the object
+class TraceScope {
+  public:
+    TraceScope(const std::string &name, const char *category)
+        : enabled(TraceRecorder::isEnabled()) {
+        if (enabled) {
+            this->name = name;
+            this->category = category;
+            this->start = TraceRecorder::Clock::now();
+        }
+    }
+
+    ~TraceScope() {
+        if (enabled) {
+            TraceRecorder::addCompleteEvent(name, category, start, TraceRecorder::Clock::now());
+        }
+    }
+
+    TraceScope(const TraceScope &) = delete;
+    TraceScope &operator=(const TraceScope &) = delete;
+
+  private:
+    const bool enabled;
+    std::string name{};
+    const char *category = nullptr;
+    TraceRecorder::Clock::time_point start{};
+};
@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "wait_helper.h"
+
+#if defined(_MSC_VER)
+#include <immintrin.h>
+#include <intrin.h>
+#define WAITPKG_FUNCTION
+#elif !defined(__ARM_ARCH)
+#include <cpuid.h>
+#include <immintrin.h>
+#include <x86intrin.h>
+#define WAITPKG_FUNCTION __attribute__((target("waitpkg")))
+#endif
+
+#if !defined(__ARM_ARCH)
+// Deadlines for umwait and tpause in TSC ticks. umwait wakes up on the write to the monitored cache line, so
+// its deadline only bounds the sleep. tpause has no such trigger, so it has to be short to keep latency low.
+constexpr static uint64_t umwaitDeadlineTicks = 100000;
+constexpr static uint64_t tpauseDeadlineTicks = 1000;
+
+// Request the C0.1 state, which has faster wake-up than C0.2
+constexpr static uint32_t waitpkgControlC01 = 1;
+
+static bool isWaitpkgSupported() {
+#if defined(_MSC_VER)
+    int registers[4] = {};
+    __cpuidex(registers, 7, 0);
+    const uint32_t ecx = static_cast<uint32_t>(registers[2]);
+#else
+    uint32_t eax{}, ebx{}, ecx{}, edx{};
+    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+        return false;
+    }
+#endif
+    return (ecx & (1u << 5)) != 0;
+}
+
+WAITPKG_FUNCTION void WaitHelper::monitor(const volatile void *address) {
+    _umonitor(const_cast<void *>(address));
+}
+
+WAITPKG_FUNCTION void WaitHelper::monitorWait() {
+    _umwait(waitpkgControlC01, __rdtsc() + umwaitDeadlineTicks);
+}
+
+WAITPKG_FUNCTION void WaitHelper::timedPause() {
+    _tpause(waitpkgControlC01, __rdtsc() + tpauseDeadlineTicks);
+}
+#else
+static bool isWaitpkgSupported() {
+    return false;
+}
+
+void WaitHelper::monitor(const volatile void *) {}
+void WaitHelper::monitorWait() {}
+void WaitHelper::timedPause() {}
+#endif
+
+bool WaitHelper::isStrategySupported(WaitStrategy strategy) {
+    switch (strategy) {
+    case WaitStrategy::Umwait:
+    case WaitStrategy::Tpause: {
+        static const bool waitpkgSupported = isWaitpkgSupported();
+        return waitpkgSupported;
+    }
+    case WaitStrategy::Spin:
+    case WaitStrategy::SpinPause:
+    case WaitStrategy::Backoff:
+    case WaitStrategy::FutexSleep:
+        return true;
+    default:
+        return false;
+    }
+}
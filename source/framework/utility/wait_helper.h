@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/configuration.h"
+#include "framework/enum/wait_strategy.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#if defined(__ARM_ARCH)
+#include <sse2neon.h>
+#else
+#include <emmintrin.h>
+#endif
+
+// Waits on host memory written by another agent (GPU or another CPU thread). Strategy defaults to the one
+// selected with --waitStrategy, so all polling loops in the benchmarks can be switched at once. Strategies
+// which are not supported by the CPU fall back to SpinPause.
+class WaitHelper {
+  public:
+    template <typename T, typename ValueT>
+    static void waitWhileEqual(const volatile T *address, ValueT value, WaitStrategy strategy = Configuration::get().waitStrategy) {
+        const T expected = static_cast<T>(value);
+        wait(address, [address, expected]() { return *address != expected; }, strategy);
+    }
+
+    template <typename T, typename ValueT>
+    static void waitUntilEqual(const volatile T *address, ValueT value, WaitStrategy strategy = Configuration::get().waitStrategy) {
+        const T expected = static_cast<T>(value);
+        wait(address, [address, expected]() { return *address == expected; }, strategy);
+    }
+
+    // Wakes threads sleeping on the address with FutexSleep strategy. Without it they wake up after a timeout.
+    static void notify(const volatile void *address); // OS-specific implementation
+
+    static bool isStrategySupported(WaitStrategy strategy);
+
+  private:
+    template <typename T, typename Condition>
+    static void wait(const volatile T *address, Condition isDone, WaitStrategy strategy) {
+        if (!isStrategySupported(strategy)) {
+            strategy = WaitStrategy::SpinPause;
+        }
+
+        switch (strategy) {
+        case WaitStrategy::Spin:
+            while (!isDone()) {
+            }
+            break;
+        case WaitStrategy::SpinPause:
+            while (!isDone()) {
+                _mm_pause();
+            }
+            break;
+        case WaitStrategy::Umwait:
+            while (!isDone()) {
+                // Check again after arming the monitor, the write could have happened in between
+                monitor(address);
+                if (isDone()) {
+                    break;
+                }
+                monitorWait();
+            }
+            break;
+        case WaitStrategy::Tpause:
+            while (!isDone()) {
+                timedPause();
+            }
+            break;
+        case WaitStrategy::Backoff: {
+            uint32_t pauses = 1;
+            while (!isDone()) {
+                if (pauses > maxBackoffPauses) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                for (uint32_t i = 0; i < pauses; i++) {
+                    _mm_pause();
+                }
+                pauses *= 2;
+            }
+            break;
+        }
+        case WaitStrategy::FutexSleep:
+            while (!isDone()) {
+                // Sleeping is done on the lowest 32 bits of the value. If only higher bits change, the wait times out.
+                const volatile uint32_t *word = reinterpret_cast<const volatile uint32_t *>(address);
+                const uint32_t observedValue = *word;
+                if (isDone()) {
+                    break;
+                }
+                sleepOnAddress(word, observedValue);
+            }
+            break;
+        default:
+            FATAL_ERROR("Unknown wait strategy");
+        }
+    }
+
+    constexpr static uint32_t maxBackoffPauses = 1024;
+
+    static void monitor(const volatile void *address);
+    static void monitorWait();
+    static void timedPause();
+    static void sleepOnAddress(const volatile uint32_t *address, uint32_t observedValue); // OS-specific implementation
+};
@@ -0,0 +1,14 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/api_call_tracer_helper.h"
+
+// The tracer relies on LD_PRELOAD, which is not available on Windows
+
+void ApiCallTracerHelper::notifyTestBegin(const std::string &) {}
+
+void ApiCallTracerHelper::notifyTestEnd() {}
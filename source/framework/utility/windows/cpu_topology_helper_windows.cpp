@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/cpu_topology_helper.h"
+#include "framework/utility/error.h"
+#include "framework/utility/windows/windows.h"
+
+#include <memory>
+
+static size_t getLowestSetBit(ULONG_PTR mask) {
+    size_t bit = 0;
+    while (mask != 0 && (mask & 1) == 0) {
+        mask >>= 1;
+        bit++;
+    }
+    return bit;
+}
+
+std::vector<CpuTopologyHelper::CpuInfo> CpuTopologyHelper::getAvailableCpus() {
+    DWORD_PTR processAffinityMask{};
+    DWORD_PTR systemAffinityMask{};
+    FATAL_ERROR_IF_SYS_CALL_FAILED(GetProcessAffinityMask(GetCurrentProcess(), &processAffinityMask, &systemAffinityMask), "GetProcessAffinityMask failed");
+
+    DWORD bufferSize = 0;
+    GetLogicalProcessorInformation(nullptr, &bufferSize);
+    const size_t entriesCount = bufferSize / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION);
+    auto entries = std::make_unique<SYSTEM_LOGICAL_PROCESSOR_INFORMATION[]>(entriesCount);
+    FATAL_ERROR_IF_SYS_CALL_FAILED(GetLogicalProcessorInformation(entries.get(), &bufferSize), "GetLogicalProcessorInformation failed");
+
+    std::vector<CpuInfo> result = {};
+    for (size_t cpuIndex = 0; cpuIndex < sizeof(DWORD_PTR) * 8; cpuIndex++) {
+        const ULONG_PTR cpuMask = ULONG_PTR{1} << cpuIndex;
+        if ((processAffinityMask & cpuMask) == 0) {
+            continue;
+        }
+
+        CpuInfo info{cpuIndex, 0, 0};
+        size_t packageIndex = 0;
+        bool hasL3 = false;
+        for (size_t entryIndex = 0; entryIndex < entriesCount; entryIndex++) {
+            const auto &entry = entries[entryIndex];
+            if (entry.Relationship == RelationProcessorPackage) {
+                if (entry.ProcessorMask & cpuMask) {
+                    info.packageId = packageIndex;
+                }
+                packageIndex++;
+            }
+            if (entry.Relationship == RelationCache && entry.Cache.Level == 3 && (entry.ProcessorMask & cpuMask)) {
+                info.l3DomainId = getLowestSetBit(entry.ProcessorMask);
+                hasL3 = true;
+            }
+        }
+        if (!hasL3) {
+            info.l3DomainId = info.packageId;
+        }
+        result.push_back(info);
+    }
+    return result;
+}
+
+bool CpuTopologyHelper::pinCurrentThread(size_t cpuIndex) {
+    const DWORD_PTR mask = DWORD_PTR{1} << cpuIndex;
+    return SetThreadAffinityMask(GetCurrentThread(), mask) != 0;
+}
@@ -0,0 +1,18 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/energy_meter.h"
+
+// RAPL counters are not exposed to user mode on Windows
+
+std::vector<EnergyMeter::Domain> EnergyMeter::discoverDomains() {
+    return {};
+}
+
+EnergyMeter::Counters EnergyMeter::readCounters() {
+    return {};
+}
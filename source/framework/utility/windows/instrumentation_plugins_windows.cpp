@@ -0,0 +1,21 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/instrumentation_plugins.h"
+#include "framework/utility/windows/windows.h"
+
+void *InstrumentationPlugins::openLibrary(const std::string &path, std::string &error) {
+    HMODULE library = LoadLibraryA(path.c_str());
+    if (library == nullptr) {
+        error = getErrorFromLastErrorCode();
+    }
+    return library;
+}
+
+void *InstrumentationPlugins::findSymbol(void *library, const char *symbol) {
+    return reinterpret_cast<void *>(GetProcAddress(static_cast<HMODULE>(library), symbol));
+}
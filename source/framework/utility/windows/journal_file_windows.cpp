@@ -0,0 +1,29 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/journal_file.h"
+#include "framework/utility/windows/windows.h"
+
+JournalFile::JournalFile(const std::string &filePath) {
+    HANDLE file = CreateFileA(filePath.c_str(), FILE_APPEND_DATA, FILE_SHARE_READ, nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    handle = reinterpret_cast<intptr_t>(file);
+}
+
+JournalFile::~JournalFile() {
+    if (isValid()) {
+        CloseHandle(reinterpret_cast<HANDLE>(handle));
+    }
+}
+
+bool JournalFile::append(const std::string &data) {
+    HANDLE file = reinterpret_cast<HANDLE>(handle);
+    DWORD bytesWritten = 0;
+    if (!WriteFile(file, data.data(), static_cast<DWORD>(data.size()), &bytesWritten, nullptr) || bytesWritten != data.size()) {
+        return false;
+    }
+    return FlushFileBuffers(file) != 0;
+}
@@ -0,0 +1,30 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/memory_footprint.h"
+#include "framework/utility/windows/windows.h"
+
+#include <Psapi.h>
+
+MemoryFootprint MemoryFootprint::capture() {
+    MemoryFootprint result{};
+
+    PROCESS_MEMORY_COUNTERS_EX counters{};
+    if (K32GetProcessMemoryInfo(GetCurrentProcess(), reinterpret_cast<PROCESS_MEMORY_COUNTERS *>(&counters), sizeof(counters))) {
+        result.residentKilobytes = counters.WorkingSetSize / 1024;
+        result.peakResidentKilobytes = counters.PeakWorkingSetSize / 1024;
+        result.anonymousKilobytes = counters.PrivateUsage / 1024;
+
+        // Windows does not distinguish minor and major faults
+        result.minorPageFaults = counters.PageFaultCount;
+    }
+    return result;
+}
+
+void MemoryFootprint::resetPeakResident() {
+    // Peak working set cannot be reset, so peak of the whole process is reported
+}
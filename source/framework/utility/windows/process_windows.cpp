@@ -11,6 +11,7 @@
 #include "framework/utility/string_utils.h"
 #include "framework/utility/windows/windows.h"
 
+#include <algorithm>
 #include <sstream>
 #include <thread>
 
@@ -95,9 +96,11 @@ void Process::run() {
     FATAL_ERROR_IF_SYS_CALL_FAILED(SetHandleInformation(processDataWindows->processStdOut.read, HANDLE_FLAG_INHERIT, 0), "setting handle inheritance")
 
     // Prepare arguments
-    this->addArgument("synchronizationPipeIn", "0");
-    this->addArgument("synchronizationPipeOut", "0");
-    this->addArgument("measurementPipe", "0");
+    if (this->passPipesAsArguments) {
+        this->addArgument("synchronizationPipeIn", "0");
+        this->addArgument("synchronizationPipeOut", "0");
+        this->addArgument("measurementPipe", "0");
+    }
     std::ostringstream commandLine = {};
     for (const auto &argument : this->arguments) {
         commandLine << argument.first;
@@ -167,12 +170,22 @@ void Process::freeOsSpecificData() {
 }
 
 void Process::waitForFinish() {
+    const bool finished = waitForFinish(std::chrono::milliseconds(INFINITE));
+    FATAL_ERROR_UNLESS(finished, "waiting for process to end timed out");
+}
+
+bool Process::waitForFinish(std::chrono::milliseconds timeout) {
     ProcessDataWindows *processDataWindows = static_cast<ProcessDataWindows *>(this->osSpecificData);
     if (processDataWindows->ended) {
-        return;
+        return true;
     }
 
-    if (WaitForSingleObject(processDataWindows->processInfo.hProcess, std::numeric_limits<DWORD>::max()) != WAIT_OBJECT_0) {
+    const auto waitTime = static_cast<DWORD>(std::min<std::chrono::milliseconds::rep>(timeout.count(), INFINITE));
+    const DWORD waitResult = WaitForSingleObject(processDataWindows->processInfo.hProcess, waitTime);
+    if (waitResult == WAIT_TIMEOUT) {
+        return false;
+    }
+    if (waitResult != WAIT_OBJECT_0) {
         FATAL_ERROR(std::string("waiting for process to end, ") + getErrorFromLastErrorCode());
     }
 
@@ -184,6 +197,19 @@ void Process::waitForFinish() {
     }
 
     processDataWindows->ended = true;
+    return true;
+}
+
+void Process::terminate() {
+    ProcessDataWindows *processDataWindows = static_cast<ProcessDataWindows *>(this->osSpecificData);
+    if (processDataWindows->ended) {
+        return;
+    }
+
+    FATAL_ERROR_IF_SYS_CALL_FAILED(TerminateProcess(processDataWindows->processInfo.hProcess, 1), "terminating process");
+    waitForFinish();
+    processDataWindows->hasResult = true;
+    processDataWindows->result = TestResult::Crash;
 }
 
 TestResult Process::getResult() {
@@ -196,6 +222,11 @@ TestResult Process::getResult() {
 
         processDataWindows->hasResult = true;
         processDataWindows->result = static_cast<TestResult>(exitCode);
+
+        // Unhandled exceptions, e.g. access violations, end the process with an NTSTATUS error code
+        if (exitCode >= 0xC0000000) {
+            processDataWindows->result = TestResult::Crash;
+        }
     }
     return processDataWindows->result;
 }
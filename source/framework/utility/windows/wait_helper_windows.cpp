@@ -0,0 +1,21 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/wait_helper.h"
+#include "framework/utility/windows/windows.h"
+
+// Memory written by the GPU does not wake up WaitOnAddress waiters, so the sleep has to be bounded.
+// Windows timeouts have millisecond granularity.
+constexpr static DWORD waitOnAddressTimeoutMs = 1;
+
+void WaitHelper::sleepOnAddress(const volatile uint32_t *address, uint32_t observedValue) {
+    WaitOnAddress(const_cast<volatile uint32_t *>(address), &observedValue, sizeof(observedValue), waitOnAddressTimeoutMs);
+}
+
+void WaitHelper::notify(const volatile void *address) {
+    WakeByAddressAll(const_cast<void *>(address));
+}
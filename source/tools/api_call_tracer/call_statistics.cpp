@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "call_statistics.h"
+
+#include "framework/utility/api_call_tracer_helper.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+constexpr static const char *outsideOfTestsName = "(outside of tests)";
+
+CallStatistics::CallStatistics() {
+    tests.push_back(TestStatistics{outsideOfTestsName, {}});
+}
+
+CallStatistics &CallStatistics::get() {
+    // Intentionally never destroyed, since API calls can still be made by other static destructors
+    static CallStatistics *instance = new CallStatistics();
+    return *instance;
+}
+
+void CallStatistics::recordCall(const char *functionName, std::chrono::nanoseconds duration) {
+    const uint64_t durationNs = static_cast<uint64_t>(duration.count());
+
+    std::lock_guard<std::mutex> lock{mutex};
+    if (summaryPrinted) {
+        return;
+    }
+    FunctionStatistics &statistics = tests[currentTestIndex].functions[functionName];
+    statistics.calls++;
+    statistics.totalNs += durationNs;
+    statistics.maxNs = std::max(statistics.maxNs, durationNs);
+    statistics.histogram.add(durationNs);
+}
+
+void CallStatistics::beginTest(const std::string &testCaseNameWithConfig) {
+    std::lock_guard<std::mutex> lock{mutex};
+    auto testIndex = testIndices.find(testCaseNameWithConfig);
+    if (testIndex == testIndices.end()) {
+        testIndex = testIndices.emplace(testCaseNameWithConfig, tests.size()).first;
+        tests.push_back(TestStatistics{testCaseNameWithConfig, {}});
+    }
+    currentTestIndex = testIndex->second;
+}
+
+void CallStatistics::endTest() {
+    std::lock_guard<std::mutex> lock{mutex};
+    currentTestIndex = 0;
+}
+
+void CallStatistics::printSummary(std::ostream &out) {
+    std::lock_guard<std::mutex> lock{mutex};
+    summaryPrinted = true;
+
+    const int nameWidth = 44;
+    const int valueWidth = 12;
+    for (const TestStatistics &test : tests) {
+        if (test.functions.empty()) {
+            continue;
+        }
+
+        // Most expensive functions first
+        std::vector<std::pair<std::string, const FunctionStatistics *>> functions{};
+        for (const auto &function : test.functions) {
+            functions.emplace_back(function.first, &function.second);
+        }
+        std::sort(functions.begin(), functions.end(), [](const auto &a, const auto &b) { return a.second->totalNs > b.second->totalNs; });
+
+        out << test.name << '\n'
+            << std::left << std::setw(nameWidth) << "    Function" << std::right
+            << std::setw(valueWidth) << "Calls"
+            << std::setw(valueWidth) << "Total[us]"
+            << std::setw(valueWidth) << "Mean[ns]"
+            << std::setw(valueWidth) << "p50[ns]"
+            << std::setw(valueWidth) << "p99[ns]"
+            << std::setw(valueWidth) << "Max[ns]" << '\n';
+        for (const auto &[name, statistics] : functions) {
+            out << "    " << std::left << std::setw(nameWidth - 4) << name << std::right
+                << std::setw(valueWidth) << statistics->calls
+                << std::setw(valueWidth) << statistics->totalNs / 1000
+                << std::setw(valueWidth) << statistics->totalNs / statistics->calls
+                << std::setw(valueWidth) << std::min(statistics->histogram.getPercentile(0.5), statistics->maxNs)
+                << std::setw(valueWidth) << std::min(statistics->histogram.getPercentile(0.99), statistics->maxNs)
+                << std::setw(valueWidth) << statistics->maxNs << '\n';
+        }
+        out << '\n';
+    }
+}
+
+void CallStatistics::Histogram::add(uint64_t value) {
+    buckets[getBucketIndex(value)]++;
+    count++;
+}
+
+uint64_t CallStatistics::Histogram::getPercentile(double percentile) const {
+    const uint64_t requiredCount = static_cast<uint64_t>(std::ceil(percentile * count));
+    uint64_t currentCount = 0;
+    for (size_t bucketIndex = 0; bucketIndex < bucketsCount; bucketIndex++) {
+        currentCount += buckets[bucketIndex];
+        if (currentCount >= requiredCount && currentCount > 0) {
+            return getBucketUpperBound(bucketIndex);
+        }
+    }
+    return 0;
+}
+
+size_t CallStatistics::Histogram::getBucketIndex(uint64_t value) {
+    if (value < subBucketsCount) {
+        return static_cast<size_t>(value);
+    }
+    size_t mostSignificantBit = 63;
+    while ((value >> mostSignificantBit) == 0) {
+        mostSignificantBit--;
+    }
+    const size_t shift = mostSignificantBit - subBucketsBits;
+    const size_t subBucket = (value >> shift) & (subBucketsCount - 1);
+    return (shift + 1) * subBucketsCount + subBucket;
+}
+
+uint64_t CallStatistics::Histogram::getBucketUpperBound(size_t bucketIndex) {
+    if (bucketIndex < subBucketsCount) {
+        return bucketIndex;
+    }
+    const size_t shift = bucketIndex / subBucketsCount - 1;
+    const uint64_t subBucket = bucketIndex % subBucketsCount;
+    const uint64_t lowerBound = (subBucketsCount + subBucket) << shift;
+    return lowerBound + (uint64_t{1} << shift) - 1;
+}
+
+// Entry points called by the framework at test boundaries, see ApiCallTracerHelper
+extern "C" __attribute__((visibility("default"))) void computeBenchmarksApiCallTracerTestBegin(const char *testCaseNameWithConfig) {
+    CallStatistics::get().beginTest(testCaseNameWithConfig);
+}
+
+extern "C" __attribute__((visibility("default"))) void computeBenchmarksApiCallTracerTestEnd() {
+    CallStatistics::get().endTest();
+}
+
+static_assert(std::is_same_v<decltype(&computeBenchmarksApiCallTracerTestBegin), ApiCallTracerHelper::TestBeginFunction>);
+static_assert(std::is_same_v<decltype(&computeBenchmarksApiCallTracerTestEnd), ApiCallTracerHelper::TestEndFunction>);
+
+// The summary goes to stderr, unless API_CALL_TRACER_OUTPUT names a file
+__attribute__((destructor)) static void printSummaryAtExit() {
+    const char *outputFile = std::getenv("API_CALL_TRACER_OUTPUT");
+    if (outputFile != nullptr) {
+        std::ofstream file{outputFile, std::ios::out | std::ios::app};
+        CallStatistics::get().printSummary(file);
+    } else {
+        CallStatistics::get().printSummary(std::cerr);
+    }
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Call counts and latency histograms of intercepted functions, kept separately for each test configuration
+// reported by the framework. Calls made outside of tests (e.g. during static initialization) are kept as well.
+class CallStatistics {
+  public:
+    // Log-linear histogram. Values below 8ns have their own buckets, above that each power of two is divided
+    // into 8 buckets, which keeps the error of reported percentiles below 12.5%.
+    struct Histogram {
+        constexpr static size_t subBucketsBits = 3;
+        constexpr static size_t subBucketsCount = 1 << subBucketsBits;
+        constexpr static size_t bucketsCount = (64 - subBucketsBits + 1) * subBucketsCount;
+
+        void add(uint64_t value);
+        uint64_t getPercentile(double percentile) const;
+
+        static size_t getBucketIndex(uint64_t value);
+        static uint64_t getBucketUpperBound(size_t bucketIndex);
+
+        std::array<uint64_t, bucketsCount> buckets = {};
+        uint64_t count = 0;
+    };
+
+    // Intercepted functions record to the instance returned by get(), separate instances are used by unit tests
+    static CallStatistics &get();
+    CallStatistics();
+
+    void recordCall(const char *functionName, std::chrono::nanoseconds duration);
+    void beginTest(const std::string &testCaseNameWithConfig);
+    void endTest();
+    void printSummary(std::ostream &out);
+
+  private:
+    struct FunctionStatistics {
+        uint64_t calls = 0;
+        uint64_t totalNs = 0;
+        uint64_t maxNs = 0;
+        Histogram histogram = {};
+    };
+
+    struct TestStatistics {
+        std::string name;
+        std::map<std::string, FunctionStatistics> functions;
+    };
+
+    std::mutex mutex;
+    std::vector<TestStatistics> tests;
+    std::map<std::string, size_t> testIndices;
+    size_t currentTestIndex = 0;
+    bool summaryPrinted = false;
+};
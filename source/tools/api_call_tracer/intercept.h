@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "call_statistics.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <dlfcn.h>
+
+// Finds the real implementation of an intercepted function, i.e. the next definition after this library
+template <typename FunctionT>
+FunctionT getNextFunction(const char *functionName) {
+    void *function = dlsym(RTLD_NEXT, functionName);
+    if (function == nullptr) {
+        fprintf(stderr, "api_call_tracer: could not find %s\n", functionName);
+        std::abort();
+    }
+    return reinterpret_cast<FunctionT>(function);
+}
+
+template <typename CallT>
+auto callAndRecord(const char *functionName, CallT &&call) {
+    const auto start = std::chrono::steady_clock::now();
+    auto result = call();
+    const auto end = std::chrono::steady_clock::now();
+    CallStatistics::get().recordCall(functionName, end - start);
+    return result;
+}
+
+// Defines an exported function with the same signature as the intercepted one. Its parameter and argument
+// lists have to be passed in parentheses.
+#define INTERCEPT(returnType, functionName, parameters, arguments)                                      \
+    extern "C" __attribute__((visibility("default"))) returnType functionName parameters {              \
+        static const auto nextFunction = getNextFunction<decltype(&functionName)>(#functionName);       \
+        return callAndRecord(#functionName, [&]() { return nextFunction arguments; });                  \
+    }
@@ -0,0 +1,212 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "intercept.h"
+
+#include <level_zero/ze_api.h>
+
+// Entry points exported by the LevelZero loader which are used by the framework and the benchmarks
+
+INTERCEPT(ze_result_t, zeInit,
+          (ze_init_flags_t flags),
+          (flags))
+
+INTERCEPT(ze_result_t, zeDriverGet,
+          (uint32_t *pCount, ze_driver_handle_t *phDrivers),
+          (pCount, phDrivers))
+
+INTERCEPT(ze_result_t, zeDriverGetProperties,
+          (ze_driver_handle_t hDriver, ze_driver_properties_t *pDriverProperties),
+          (hDriver, pDriverProperties))
+
+INTERCEPT(ze_result_t, zeDriverGetIpcProperties,
+          (ze_driver_handle_t hDriver, ze_driver_ipc_properties_t *pIpcProperties),
+          (hDriver, pIpcProperties))
+
+INTERCEPT(ze_result_t, zeDriverGetExtensionFunctionAddress,
+          (ze_driver_handle_t hDriver, const char *name, void** ppFunctionAddress),
+          (hDriver, name, ppFunctionAddress))
+
+INTERCEPT(ze_result_t, zeDeviceGet,
+          (ze_driver_handle_t hDriver, uint32_t *pCount, ze_device_handle_t *phDevices),
+          (hDriver, pCount, phDevices))
+
+INTERCEPT(ze_result_t, zeDeviceGetSubDevices,
+          (ze_device_handle_t hDevice, uint32_t *pCount, ze_device_handle_t *phSubdevices),
+          (hDevice, pCount, phSubdevices))
+
+INTERCEPT(ze_result_t, zeDeviceGetProperties,
+          (ze_device_handle_t hDevice, ze_device_properties_t *pDeviceProperties),
+          (hDevice, pDeviceProperties))
+
+INTERCEPT(ze_result_t, zeDeviceGetComputeProperties,
+          (ze_device_handle_t hDevice, ze_device_compute_properties_t *pComputeProperties),
+          (hDevice, pComputeProperties))
+
+INTERCEPT(ze_result_t, zeDeviceGetImageProperties,
+          (ze_device_handle_t hDevice, ze_device_image_properties_t *pImageProperties),
+          (hDevice, pImageProperties))
+
+INTERCEPT(ze_result_t, zeDeviceGetCommandQueueGroupProperties,
+          (ze_device_handle_t hDevice, uint32_t *pCount, ze_command_queue_group_properties_t *pCommandQueueGroupProperties),
+          (hDevice, pCount, pCommandQueueGroupProperties))
+
+INTERCEPT(ze_result_t, zeContextCreate,
+          (ze_driver_handle_t hDriver, const ze_context_desc_t *desc, ze_context_handle_t *phContext),
+          (hDriver, desc, phContext))
+
+INTERCEPT(ze_result_t, zeContextDestroy,
+          (ze_context_handle_t hContext),
+          (hContext))
+
+INTERCEPT(ze_result_t, zeCommandQueueCreate,
+          (ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_command_queue_desc_t *desc, ze_command_queue_handle_t *phCommandQueue),
+          (hContext, hDevice, desc, phCommandQueue))
+
+INTERCEPT(ze_result_t, zeCommandQueueDestroy,
+          (ze_command_queue_handle_t hCommandQueue),
+          (hCommandQueue))
+
+INTERCEPT(ze_result_t, zeCommandQueueExecuteCommandLists,
+          (ze_command_queue_handle_t hCommandQueue, uint32_t numCommandLists, ze_command_list_handle_t *phCommandLists, ze_fence_handle_t hFence),
+          (hCommandQueue, numCommandLists, phCommandLists, hFence))
+
+INTERCEPT(ze_result_t, zeCommandQueueSynchronize,
+          (ze_command_queue_handle_t hCommandQueue, uint64_t timeout),
+          (hCommandQueue, timeout))
+
+INTERCEPT(ze_result_t, zeCommandListCreate,
+          (ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_command_list_desc_t *desc, ze_command_list_handle_t *phCommandList),
+          (hContext, hDevice, desc, phCommandList))
+
+INTERCEPT(ze_result_t, zeCommandListCreateImmediate,
+          (ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_command_queue_desc_t *altdesc, ze_command_list_handle_t *phCommandList),
+          (hContext, hDevice, altdesc, phCommandList))
+
+INTERCEPT(ze_result_t, zeCommandListDestroy,
+          (ze_command_list_handle_t hCommandList),
+          (hCommandList))
+
+INTERCEPT(ze_result_t, zeCommandListClose,
+          (ze_command_list_handle_t hCommandList),
+          (hCommandList))
+
+INTERCEPT(ze_result_t, zeCommandListReset,
+          (ze_command_list_handle_t hCommandList),
+          (hCommandList))
+
+INTERCEPT(ze_result_t, zeCommandListAppendBarrier,
+          (ze_command_list_handle_t hCommandList, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents),
+          (hCommandList, hSignalEvent, numWaitEvents, phWaitEvents))
+
+INTERCEPT(ze_result_t, zeCommandListAppendMemoryCopy,
+          (ze_command_list_handle_t hCommandList, void *dstptr, const void *srcptr, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents),
+          (hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents))
+
+INTERCEPT(ze_result_t, zeCommandListAppendMemoryFill,
+          (ze_command_list_handle_t hCommandList, void *ptr, const void *pattern, size_t pattern_size, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents),
+          (hCommandList, ptr, pattern, pattern_size, size, hSignalEvent, numWaitEvents, phWaitEvents))
+
+INTERCEPT(ze_result_t, zeCommandListAppendLaunchKernel,
+          (ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel, const ze_group_count_t *pLaunchFuncArgs, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents),
+          (hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents))
+
+INTERCEPT(ze_result_t, zeCommandListAppendSignalEvent,
+          (ze_command_list_handle_t hCommandList, ze_event_handle_t hEvent),
+          (hCommandList, hEvent))
+
+INTERCEPT(ze_result_t, zeCommandListAppendWaitOnEvents,
+          (ze_command_list_handle_t hCommandList, uint32_t numEvents, ze_event_handle_t *phEvents),
+          (hCommandList, numEvents, phEvents))
+
+INTERCEPT(ze_result_t, zeEventPoolCreate,
+          (ze_context_handle_t hContext, const ze_event_pool_desc_t *desc, uint32_t numDevices, ze_device_handle_t *phDevices, ze_event_pool_handle_t *phEventPool),
+          (hContext, desc, numDevices, phDevices, phEventPool))
+
+INTERCEPT(ze_result_t, zeEventPoolDestroy,
+          (ze_event_pool_handle_t hEventPool),
+          (hEventPool))
+
+INTERCEPT(ze_result_t, zeEventCreate,
+          (ze_event_pool_handle_t hEventPool, const ze_event_desc_t *desc, ze_event_handle_t *phEvent),
+          (hEventPool, desc, phEvent))
+
+INTERCEPT(ze_result_t, zeEventDestroy,
+          (ze_event_handle_t hEvent),
+          (hEvent))
+
+INTERCEPT(ze_result_t, zeEventHostSignal,
+          (ze_event_handle_t hEvent),
+          (hEvent))
+
+INTERCEPT(ze_result_t, zeEventHostSynchronize,
+          (ze_event_handle_t hEvent, uint64_t timeout),
+          (hEvent, timeout))
+
+INTERCEPT(ze_result_t, zeEventHostReset,
+          (ze_event_handle_t hEvent),
+          (hEvent))
+
+INTERCEPT(ze_result_t, zeEventQueryStatus,
+          (ze_event_handle_t hEvent),
+          (hEvent))
+
+INTERCEPT(ze_result_t, zeFenceCreate,
+          (ze_command_queue_handle_t hCommandQueue, const ze_fence_desc_t *desc, ze_fence_handle_t *phFence),
+          (hCommandQueue, desc, phFence))
+
+INTERCEPT(ze_result_t, zeFenceDestroy,
+          (ze_fence_handle_t hFence),
+          (hFence))
+
+INTERCEPT(ze_result_t, zeFenceHostSynchronize,
+          (ze_fence_handle_t hFence, uint64_t timeout),
+          (hFence, timeout))
+
+INTERCEPT(ze_result_t, zeFenceReset,
+          (ze_fence_handle_t hFence),
+          (hFence))
+
+INTERCEPT(ze_result_t, zeMemAllocShared,
+          (ze_context_handle_t hContext, const ze_device_mem_alloc_desc_t *device_desc, const ze_host_mem_alloc_desc_t *host_desc, size_t size, size_t alignment, ze_device_handle_t hDevice, void** pptr),
+          (hContext, device_desc, host_desc, size, alignment, hDevice, pptr))
+
+INTERCEPT(ze_result_t, zeMemAllocDevice,
+          (ze_context_handle_t hContext, const ze_device_mem_alloc_desc_t *device_desc, size_t size, size_t alignment, ze_device_handle_t hDevice, void** pptr),
+          (hContext, device_desc, size, alignment, hDevice, pptr))
+
+INTERCEPT(ze_result_t, zeMemAllocHost,
+          (ze_context_handle_t hContext, const ze_host_mem_alloc_desc_t *host_desc, size_t size, size_t alignment, void** pptr),
+          (hContext, host_desc, size, alignment, pptr))
+
+INTERCEPT(ze_result_t, zeMemFree,
+          (ze_context_handle_t hContext, void *ptr),
+          (hContext, ptr))
+
+INTERCEPT(ze_result_t, zeModuleCreate,
+          (ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_module_desc_t *desc, ze_module_handle_t *phModule, ze_module_build_log_handle_t *phBuildLog),
+          (hContext, hDevice, desc, phModule, phBuildLog))
+
+INTERCEPT(ze_result_t, zeModuleDestroy,
+          (ze_module_handle_t hModule),
+          (hModule))
+
+INTERCEPT(ze_result_t, zeKernelCreate,
+          (ze_module_handle_t hModule, const ze_kernel_desc_t *desc, ze_kernel_handle_t *phKernel),
+          (hModule, desc, phKernel))
+
+INTERCEPT(ze_result_t, zeKernelDestroy,
+          (ze_kernel_handle_t hKernel),
+          (hKernel))
+
+INTERCEPT(ze_result_t, zeKernelSetGroupSize,
+          (ze_kernel_handle_t hKernel, uint32_t groupSizeX, uint32_t groupSizeY, uint32_t groupSizeZ),
+          (hKernel, groupSizeX, groupSizeY, groupSizeZ))
+
+INTERCEPT(ze_result_t, zeKernelSetArgumentValue,
+          (ze_kernel_handle_t hKernel, uint32_t argIndex, size_t argSize, const void *pArgValue),
+          (hKernel, argIndex, argSize, pArgValue))
@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/ocl/cl.h"
+
+#include "intercept.h"
+
+// Entry points exported by the OpenCL ICD loader which are used by the framework and the benchmarks. Extension
+// functions (e.g. USM allocations) are obtained with clGetExtensionFunctionAddressForPlatform and cannot be
+// intercepted this way. Only the call to clGetExtensionFunctionAddressForPlatform itself is recorded.
+
+INTERCEPT(cl_int, clGetPlatformIDs,
+          (cl_uint num_entries, cl_platform_id *platforms, cl_uint *num_platforms),
+          (num_entries, platforms, num_platforms))
+
+INTERCEPT(cl_int, clGetPlatformInfo,
+          (cl_platform_id platform, cl_platform_info param_name, size_t param_value_size, void *param_value, size_t *param_value_size_ret),
+          (platform, param_name, param_value_size, param_value, param_value_size_ret))
+
+INTERCEPT(cl_int, clGetDeviceIDs,
+          (cl_platform_id platform, cl_device_type device_type, cl_uint num_entries, cl_device_id *devices, cl_uint *num_devices),
+          (platform, device_type, num_entries, devices, num_devices))
+
+INTERCEPT(cl_int, clGetDeviceInfo,
+          (cl_device_id device, cl_device_info param_name, size_t param_value_size, void *param_value, size_t *param_value_size_ret),
+          (device, param_name, param_value_size, param_value, param_value_size_ret))
+
+INTERCEPT(cl_int, clCreateSubDevices,
+          (cl_device_id in_device, const cl_device_partition_property *properties, cl_uint num_devices, cl_device_id *out_devices, cl_uint *num_devices_ret),
+          (in_device, properties, num_devices, out_devices, num_devices_ret))
+
+INTERCEPT(cl_int, clReleaseDevice,
+          (cl_device_id device),
+          (device))
+
+INTERCEPT(cl_context, clCreateContext,
+          (const cl_context_properties *properties, cl_uint num_devices, const cl_device_id *devices, void (CL_CALLBACK *pfn_notify)(const char *errinfo, const void *private_info, size_t cb, void *user_data), void *user_data, cl_int *errcode_ret),
+          (properties, num_devices, devices, pfn_notify, user_data, errcode_ret))
+
+INTERCEPT(cl_int, clReleaseContext,
+          (cl_context context),
+          (context))
+
+INTERCEPT(cl_command_queue, clCreateCommandQueueWithProperties,
+          (cl_context context, cl_device_id device, const cl_queue_properties *properties, cl_int *errcode_ret),
+          (context, device, properties, errcode_ret))
+
+INTERCEPT(cl_int, clReleaseCommandQueue,
+          (cl_command_queue command_queue),
+          (command_queue))
+
+INTERCEPT(cl_int, clGetCommandQueueInfo,
+          (cl_command_queue command_queue, cl_command_queue_info param_name, size_t param_value_size, void *param_value, size_t *param_value_size_ret),
+          (command_queue, param_name, param_value_size, param_value, param_value_size_ret))
+
+INTERCEPT(cl_mem, clCreateBuffer,
+          (cl_context context, cl_mem_flags flags, size_t size, void *host_ptr, cl_int *errcode_ret),
+          (context, flags, size, host_ptr, errcode_ret))
+
+INTERCEPT(cl_int, clReleaseMemObject,
+          (cl_mem memobj),
+          (memobj))
+
+INTERCEPT(cl_int, clGetMemObjectInfo,
+          (cl_mem memobj, cl_mem_info param_name, size_t param_value_size, void *param_value, size_t *param_value_size_ret),
+          (memobj, param_name, param_value_size, param_value, param_value_size_ret))
+
+INTERCEPT(cl_program, clCreateProgramWithSource,
+          (cl_context context, cl_uint count, const char ** strings, const size_t *lengths, cl_int *errcode_ret),
+          (context, count, strings, lengths, errcode_ret))
+
+INTERCEPT(cl_int, clBuildProgram,
+          (cl_program program, cl_uint num_devices, const cl_device_id *device_list, const char *options, void (CL_CALLBACK *pfn_notify)(cl_program program, void *user_data), void *user_data),
+          (program, num_devices, device_list, options, pfn_notify, user_data))
+
+INTERCEPT(cl_int, clGetProgramBuildInfo,
+          (cl_program program, cl_device_id device, cl_program_build_info param_name, size_t param_value_size, void *param_value, size_t *param_value_size_ret),
+          (program, device, param_name, param_value_size, param_value, param_value_size_ret))
+
+INTERCEPT(cl_int, clReleaseProgram,
+          (cl_program program),
+          (program))
+
+INTERCEPT(cl_kernel, clCreateKernel,
+          (cl_program program, const char *kernel_name, cl_int *errcode_ret),
+          (program, kernel_name, errcode_ret))
+
+INTERCEPT(cl_int, clReleaseKernel,
+          (cl_kernel kernel),
+          (kernel))
+
+INTERCEPT(cl_int, clSetKernelArg,
+          (cl_kernel kernel, cl_uint arg_index, size_t arg_size, const void *arg_value),
+          (kernel, arg_index, arg_size, arg_value))
+
+INTERCEPT(cl_int, clWaitForEvents,
+          (cl_uint num_events, const cl_event *event_list),
+          (num_events, event_list))
+
+INTERCEPT(cl_int, clReleaseEvent,
+          (cl_event event),
+          (event))
+
+INTERCEPT(cl_int, clGetEventProfilingInfo,
+          (cl_event event, cl_profiling_info param_name, size_t param_value_size, void *param_value, size_t *param_value_size_ret),
+          (event, param_name, param_value_size, param_value, param_value_size_ret))
+
+INTERCEPT(cl_int, clFlush,
+          (cl_command_queue command_queue),
+          (command_queue))
+
+INTERCEPT(cl_int, clFinish,
+          (cl_command_queue command_queue),
+          (command_queue))
+
+INTERCEPT(cl_int, clEnqueueReadBuffer,
+          (cl_command_queue command_queue, cl_mem buffer, cl_bool blocking_read, size_t offset, size_t size, void *ptr, cl_uint num_events_in_wait_list, const cl_event *event_wait_list, cl_event *event),
+          (command_queue, buffer, blocking_read, offset, size, ptr, num_events_in_wait_list, event_wait_list, event))
+
+INTERCEPT(cl_int, clEnqueueWriteBuffer,
+          (cl_command_queue command_queue, cl_mem buffer, cl_bool blocking_write, size_t offset, size_t size, const void *ptr, cl_uint num_events_in_wait_list, const cl_event *event_wait_list, cl_event *event),
+          (command_queue, buffer, blocking_write, offset, size, ptr, num_events_in_wait_list, event_wait_list, event))
+
+INTERCEPT(cl_int, clEnqueueCopyBuffer,
+          (cl_command_queue command_queue, cl_mem src_buffer, cl_mem dst_buffer, size_t src_offset, size_t dst_offset, size_t size, cl_uint num_events_in_wait_list, const cl_event *event_wait_list, cl_event *event),
+          (command_queue, src_buffer, dst_buffer, src_offset, dst_offset, size, num_events_in_wait_list, event_wait_list, event))
+
+INTERCEPT(cl_int, clEnqueueFillBuffer,
+          (cl_command_queue command_queue, cl_mem buffer, const void *pattern, size_t pattern_size, size_t offset, size_t size, cl_uint num_events_in_wait_list, const cl_event *event_wait_list, cl_event *event),
+          (command_queue, buffer, pattern, pattern_size, offset, size, num_events_in_wait_list, event_wait_list, event))
+
+INTERCEPT(void *, clEnqueueMapBuffer,
+          (cl_command_queue command_queue, cl_mem buffer, cl_bool blocking_map, cl_map_flags map_flags, size_t offset, size_t size, cl_uint num_events_in_wait_list, const cl_event *event_wait_list, cl_event *event, cl_int *errcode_ret),
+          (command_queue, buffer, blocking_map, map_flags, offset, size, num_events_in_wait_list, event_wait_list, event, errcode_ret))
+
+INTERCEPT(cl_int, clEnqueueUnmapMemObject,
+          (cl_command_queue command_queue, cl_mem memobj, void *mapped_ptr, cl_uint num_events_in_wait_list, const cl_event *event_wait_list, cl_event *event),
+          (command_queue, memobj, mapped_ptr, num_events_in_wait_list, event_wait_list, event))
+
+INTERCEPT(cl_int, clEnqueueNDRangeKernel,
+          (cl_command_queue command_queue, cl_kernel kernel, cl_uint work_dim, const size_t *global_work_offset, const size_t *global_work_size, const size_t *local_work_size, cl_uint num_events_in_wait_list, const cl_event *event_wait_list, cl_event *event),
+          (command_queue, kernel, work_dim, global_work_offset, global_work_size, local_work_size, num_events_in_wait_list, event_wait_list, event))
+
+INTERCEPT(cl_int, clEnqueueMarkerWithWaitList,
+          (cl_command_queue command_queue, cl_uint num_events_in_wait_list, const cl_event *event_wait_list, cl_event *event),
+          (command_queue, num_events_in_wait_list, event_wait_list, event))
+
+INTERCEPT(cl_int, clEnqueueBarrierWithWaitList,
+          (cl_command_queue command_queue, cl_uint num_events_in_wait_list, const cl_event *event_wait_list, cl_event *event),
+          (command_queue, num_events_in_wait_list, event_wait_list, event))
+
+INTERCEPT(void *, clGetExtensionFunctionAddressForPlatform,
+          (cl_platform_id platform, const char *func_name),
+          (platform, func_name))
@@ -0,0 +1,289 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/argument/argument_container.h"
+#include "framework/argument/basic_argument.h"
+#include "framework/argument/boolean_flag_argument.h"
+#include "framework/argument/string_argument.h"
+#include "framework/utility/cpu_topology_helper.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <thread>
+#include <vector>
+#if defined(__ARM_ARCH)
+#include <sse2neon.h>
+#else
+#include <emmintrin.h>
+#endif
+
+// Measures how long it takes to hand a cache line over between two CPU cores. Two threads are pinned to a pair
+// of cores and bounce a single cache line back and forth. Half of the round trip time is reported as the one-way
+// latency. This is the cost a host thread pays when polling on memory written by another core, which is what
+// WriteLatency or RoundTripSubmission effectively measure on the CPU side.
+
+enum class PingPongMode {
+    Store,
+    CompareExchange,
+    Clflush,
+};
+
+const static std::pair<PingPongMode, const char *> pingPongModes[] = {
+    {PingPongMode::Store, "store"},
+    {PingPongMode::CompareExchange, "cas"},
+    {PingPongMode::Clflush, "clflush"},
+};
+
+struct CoreToCoreLatencyArguments : ArgumentContainer {
+    BooleanFlagArgument help;
+    PositiveIntegerArgument iterations;
+    PositiveIntegerArgument samples;
+    StringArgument mode;
+
+    CoreToCoreLatencyArguments()
+        : help(*this, "help", "Shows this message"),
+          iterations(*this, "iterations", "Round trips performed in a single sample"),
+          samples(*this, "samples", "Samples taken for each pair of cores. Median is reported"),
+          mode(*this, "mode", "Cache line transfer method (store or cas or clflush or all)") {
+        help = false;
+        iterations = 1000;
+        samples = 5;
+        mode = "all";
+    }
+
+    bool validateArgumentsExtra() const override {
+        const std::string &modeName = mode;
+        const auto isKnownMode = [&modeName](const auto &entry) { return modeName == entry.second; };
+        return modeName == "all" || std::any_of(std::begin(pingPongModes), std::end(pingPongModes), isKnownMode);
+    }
+};
+
+struct alignas(64) SharedCacheLine {
+    std::atomic<uint64_t> value;
+};
+
+static void waitForValue(std::atomic<uint64_t> &value, uint64_t expected) {
+    while (value.load(std::memory_order_acquire) != expected) {
+        _mm_pause();
+    }
+}
+
+static void transfer(PingPongMode mode, SharedCacheLine &line, uint64_t from, uint64_t to) {
+    switch (mode) {
+    case PingPongMode::Store:
+        waitForValue(line.value, from);
+        line.value.store(to, std::memory_order_release);
+        break;
+    case PingPongMode::CompareExchange: {
+        uint64_t expected = from;
+        while (!line.value.compare_exchange_weak(expected, to, std::memory_order_acq_rel)) {
+            expected = from;
+            _mm_pause();
+        }
+        break;
+    }
+    case PingPongMode::Clflush:
+        // Same as WriteLatency - the line is evicted after each write, so the other core reads it from memory
+        waitForValue(line.value, from);
+        line.value.store(to, std::memory_order_release);
+        _mm_clflush(&line);
+        break;
+    }
+}
+
+static double measureOneWayLatency(PingPongMode mode, size_t firstCpu, size_t secondCpu, size_t iterations) {
+    SharedCacheLine line{};
+    std::atomic<uint32_t> readyThreads{0};
+
+    const auto pinAndSynchronize = [&readyThreads](size_t cpu) {
+        FATAL_ERROR_IF(!CpuTopologyHelper::pinCurrentThread(cpu), "Could not pin thread to CPU ", cpu);
+        readyThreads++;
+        while (readyThreads.load() != 2) {
+        }
+    };
+
+    std::thread pongThread([&]() {
+        pinAndSynchronize(secondCpu);
+        for (uint64_t i = 0; i < iterations; i++) {
+            transfer(mode, line, 2 * i + 1, 2 * i + 2);
+        }
+    });
+
+    pinAndSynchronize(firstCpu);
+    const auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < iterations; i++) {
+        transfer(mode, line, 2 * i, 2 * i + 1);
+    }
+    waitForValue(line.value, 2 * iterations);
+    const auto end = std::chrono::steady_clock::now();
+    pongThread.join();
+
+    const double roundTripNs = std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+    return roundTripNs / 2;
+}
+
+static double median(std::vector<double> values) {
+    std::sort(values.begin(), values.end());
+    const size_t count = values.size();
+    return (count % 2 == 0) ? (values[count / 2 - 1] + values[count / 2]) / 2 : values[count / 2];
+}
+
+using LatencyMatrix = std::vector<std::vector<double>>;
+
+static LatencyMatrix measureMatrix(PingPongMode mode, const std::vector<CpuTopologyHelper::CpuInfo> &cpus, size_t iterations, size_t samples) {
+    const size_t cpuCount = cpus.size();
+    LatencyMatrix matrix(cpuCount, std::vector<double>(cpuCount, 0.0));
+    for (size_t first = 0; first < cpuCount; first++) {
+        for (size_t second = first + 1; second < cpuCount; second++) {
+            std::vector<double> results{};
+            for (size_t sample = 0; sample < samples; sample++) {
+                results.push_back(measureOneWayLatency(mode, cpus[first].cpuIndex, cpus[second].cpuIndex, iterations));
+            }
+            matrix[first][second] = matrix[second][first] = median(results);
+        }
+    }
+    return matrix;
+}
+
+static void printMatrix(const LatencyMatrix &matrix, const std::vector<CpuTopologyHelper::CpuInfo> &cpus) {
+    const int width = 10;
+    std::cout << std::setw(width) << "cpu";
+    for (const auto &cpu : cpus) {
+        std::cout << std::setw(width) << cpu.cpuIndex;
+    }
+    std::cout << '\n';
+
+    for (size_t row = 0; row < cpus.size(); row++) {
+        std::cout << std::setw(width) << cpus[row].cpuIndex;
+        for (size_t column = 0; column < cpus.size(); column++) {
+            if (row == column) {
+                std::cout << std::setw(width) << "-";
+            } else {
+                std::cout << std::setw(width) << std::fixed << std::setprecision(1) << matrix[row][column];
+            }
+        }
+        std::cout << '\n';
+    }
+}
+
+static void printSummary(const LatencyMatrix &matrix, const std::vector<CpuTopologyHelper::CpuInfo> &cpus) {
+    struct Accumulator {
+        double sum = 0;
+        size_t count = 0;
+        double min = std::numeric_limits<double>::max();
+        double max = 0;
+        void add(double value) {
+            sum += value;
+            count++;
+            min = std::min(min, value);
+            max = std::max(max, value);
+        }
+    };
+
+    std::map<size_t, Accumulator> perL3Domain{};
+    std::map<size_t, Accumulator> perSocket{};
+    Accumulator crossL3Domain{};
+    Accumulator crossSocket{};
+    for (size_t first = 0; first < cpus.size(); first++) {
+        for (size_t second = first + 1; second < cpus.size(); second++) {
+            const double latency = matrix[first][second];
+            if (cpus[first].packageId != cpus[second].packageId) {
+                crossSocket.add(latency);
+                continue;
+            }
+            if (cpus[first].l3DomainId == cpus[second].l3DomainId) {
+                perL3Domain[cpus[first].l3DomainId].add(latency);
+            } else {
+                perSocket[cpus[first].packageId].add(latency);
+                crossL3Domain.add(latency);
+            }
+        }
+    }
+
+    const auto printAccumulator = [](const std::string &label, const Accumulator &accumulator) {
+        if (accumulator.count == 0) {
+            return;
+        }
+        std::cout << "  " << std::left << std::setw(40) << label << std::right << std::fixed << std::setprecision(1)
+                  << "avg=" << accumulator.sum / accumulator.count << " ns, min=" << accumulator.min << " ns, max=" << accumulator.max << " ns\n";
+    };
+    for (const auto &[l3DomainId, accumulator] : perL3Domain) {
+        printAccumulator("within L3 domain " + std::to_string(l3DomainId), accumulator);
+    }
+    for (const auto &[packageId, accumulator] : perSocket) {
+        printAccumulator("across L3 domains in socket " + std::to_string(packageId), accumulator);
+    }
+    if (perSocket.size() > 1) {
+        // With a single socket this is the same as its line above
+        printAccumulator("across L3 domains, all sockets", crossL3Domain);
+    }
+    printAccumulator("across sockets", crossSocket);
+
+    // Best core to poll from, assuming the other side can run anywhere
+    size_t bestCpu = 0;
+    double bestAverage = std::numeric_limits<double>::max();
+    for (size_t row = 0; row < cpus.size(); row++) {
+        double sum = 0;
+        for (size_t column = 0; column < cpus.size(); column++) {
+            sum += matrix[row][column];
+        }
+        const double average = sum / (cpus.size() - 1);
+        if (average < bestAverage) {
+            bestAverage = average;
+            bestCpu = row;
+        }
+    }
+    std::cout << "  lowest average latency to other cores: cpu " << cpus[bestCpu].cpuIndex << " (" << bestAverage << " ns)\n";
+}
+
+int main(int argc, char **argv) {
+    CommandLineArguments commandLineArguments{};
+    std::string errorMessage{};
+    if (!CommandLineArgument::parseArguments(argc, argv, commandLineArguments, errorMessage)) {
+        std::cerr << errorMessage << std::endl;
+        return 1;
+    }
+
+    CoreToCoreLatencyArguments arguments{};
+    arguments.parseArguments(commandLineArguments);
+    if (!CommandLineArgument::getUnprocessedArguments(commandLineArguments).empty() || !arguments.validateArguments()) {
+        std::cerr << "Error parsing command line\n";
+        return 1;
+    }
+    if (arguments.help) {
+        std::cout << "Measures one-way cache line transfer latency between every pair of available CPU cores. Parameters:\n"
+                  << arguments.getHelp(1u);
+        return 0;
+    }
+
+    const auto cpus = CpuTopologyHelper::getAvailableCpus();
+    if (cpus.size() < 2) {
+        std::cerr << "At least two CPUs are required\n";
+        return 1;
+    }
+
+    const std::string &selectedMode = arguments.mode;
+    for (const auto &[mode, modeName] : pingPongModes) {
+        if (selectedMode != "all" && selectedMode != modeName) {
+            continue;
+        }
+
+        std::cout << "--- One-way latency [ns], mode=" << modeName << " ---\n";
+        const LatencyMatrix matrix = measureMatrix(mode, cpus, arguments.iterations, arguments.samples);
+        printMatrix(matrix, cpus);
+        std::cout << "Summary:\n";
+        printSummary(matrix, cpus);
+        std::cout << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/instrumentation_plugin_interface.h"
+
+#include <atomic>
+#include <ctime>
+
+// Example instrumentation plugin, loaded with --plugin=<path to the library>. For each iteration it reports CPU time
+// consumed by the whole process since the previous iteration and the number of timed regions (Timer::measureStart
+// and measureEnd pairs). A benchmark waiting for the GPU by spinning on the CPU will show CPU time close to its
+// measured time, while one blocking in the driver will show much less.
+
+namespace {
+struct PluginState {
+    std::clock_t lastCpuTime = 0;
+    std::atomic<uint64_t> timedRegions = 0;
+};
+
+void onTestBegin(void *userData, const char *) {
+    auto state = static_cast<PluginState *>(userData);
+    state->lastCpuTime = std::clock();
+    state->timedRegions = 0;
+}
+
+void onIterationEnd(void *userData, uint64_t) {
+    auto state = static_cast<PluginState *>(userData);
+    state->timedRegions++;
+}
+
+void onSamplePush(void *userData, const char *, const char *, double, const ComputeBenchmarksSampleSink *sink) {
+    if (sink == nullptr) {
+        return;
+    }
+
+    auto state = static_cast<PluginState *>(userData);
+    const std::clock_t cpuTime = std::clock();
+    const double cpuTimeMicroseconds = 1e6 * static_cast<double>(cpuTime - state->lastCpuTime) / CLOCKS_PER_SEC;
+    state->lastCpuTime = cpuTime;
+
+    sink->pushSample(sink->context, "process cpu time", "us", cpuTimeMicroseconds);
+    sink->pushSample(sink->context, "timed regions", "count", static_cast<double>(state->timedRegions.exchange(0)));
+}
+
+void onUnload(void *userData) {
+    delete static_cast<PluginState *>(userData);
+}
+} // namespace
+
+extern "C" COMPUTE_BENCHMARKS_PLUGIN_EXPORT int computeBenchmarksPluginInit(uint32_t apiVersion, ComputeBenchmarksPluginCallbacks *callbacks) {
+    if (apiVersion != COMPUTE_BENCHMARKS_PLUGIN_API_VERSION) {
+        return 1;
+    }
+
+    callbacks->userData = new PluginState{};
+    callbacks->onTestBegin = onTestBegin;
+    callbacks->onIterationEnd = onIterationEnd;
+    callbacks->onSamplePush = onSamplePush;
+    callbacks->onUnload = onUnload;
+    return 0;
+}
@@ -0,0 +1,461 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/argument/argument_container.h"
+#include "framework/argument/basic_argument.h"
+#include "framework/argument/boolean_flag_argument.h"
+#include "framework/argument/enum/atomic_math_operation_argument.h"
+#include "framework/argument/enum/atomic_scope_argument.h"
+#include "framework/argument/enum/data_type_argument.h"
+#include "framework/enum/atomic_memory_order.h"
+#include "framework/utility/cpu_topology_helper.h"
+#include "framework/utility/math_operation_helper.h"
+#include "framework/utility/memory_constants.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <thread>
+#include <vector>
+#if defined(__ARM_ARCH)
+#include <sse2neon.h>
+#else
+#include <emmintrin.h>
+#endif
+
+// Host counterpart of the atomic_benchmark explicit test cases. Threads perform atomic operations with every
+// memory order, either all on one address (OneAtomicExplicit) or each on its own address, packed
+// atomicsPerCacheline to a cache line (SeparateAtomicsExplicit). Scope selects thread placement: workgroup packs
+// the threads into one L3 domain, device spreads them over all of them. Standalone fence costs are measured as
+// well, which helps judging the price of host-side synchronization done by the drivers.
+
+struct HostAtomicBenchmarkArguments : ArgumentContainer {
+    BooleanFlagArgument help;
+    DataTypeArgument dataType;
+    AtomicMathOperationArgument atomicOperation;
+    AtomicScopeArgument scope;
+    PositiveIntegerArgument atomicsPerCacheline;
+    NonNegativeIntegerArgument threads;
+    PositiveIntegerArgument iterations;
+    PositiveIntegerArgument samples;
+
+    HostAtomicBenchmarkArguments()
+        : help(*this, "help", "Shows this message"),
+          dataType(*this, "type", "Data type used for atomic operations"),
+          atomicOperation(*this, "op", "Atomic operation to perform"),
+          scope(*this, "scope", "Placement of the threads. Workgroup uses CPUs sharing an L3 cache, device uses all CPUs"),
+          atomicsPerCacheline(*this, "atomicsPerCacheline", "Number of used addresses occupying a single cacheline in separate address layout"),
+          threads(*this, "threads", "Number of threads. 0 means one thread per available CPU in the scope"),
+          iterations(*this, "iterations", "Operations performed by each thread in a single sample"),
+          samples(*this, "samples", "Samples taken for each configuration. Median is reported") {
+        help = false;
+        dataType = DataType::Int32;
+        atomicOperation = MathOperation::Add;
+        scope = AtomicScope::Device;
+        atomicsPerCacheline = 1;
+        threads = 0;
+        iterations = 100000;
+        samples = 5;
+    }
+
+    bool validateArgumentsExtra() const override {
+        if (!MathOperationHelper::isSupportedAsAtomic(atomicOperation, dataType, true, false)) {
+            std::cerr << "Atomic operation is not supported for this data type\n";
+            return false;
+        }
+        if (atomicsPerCacheline > MemoryConstants::cachelineSize / DataTypeHelper::getSize(dataType)) {
+            std::cerr << "Too many atomics per cacheline for this data type\n";
+            return false;
+        }
+        return true;
+    }
+};
+
+enum class Layout {
+    OneAtomic,
+    SeparateAtomics,
+};
+
+enum class Fence {
+    None,
+    Mfence,
+    Sfence,
+    Lfence,
+    AtomicThreadFenceAcquire,
+    AtomicThreadFenceRelease,
+    AtomicThreadFenceAcquireRelease,
+    AtomicThreadFenceSequentialConsistent,
+};
+
+const static std::pair<Fence, const char *> fences[] = {
+    {Fence::None, "none"},
+    {Fence::Mfence, "mfence"},
+    {Fence::Sfence, "sfence"},
+    {Fence::Lfence, "lfence"},
+    {Fence::AtomicThreadFenceAcquire, "atomic_thread_fence(acquire)"},
+    {Fence::AtomicThreadFenceRelease, "atomic_thread_fence(release)"},
+    {Fence::AtomicThreadFenceAcquireRelease, "atomic_thread_fence(acq_rel)"},
+    {Fence::AtomicThreadFenceSequentialConsistent, "atomic_thread_fence(seq_cst)"},
+};
+
+// Threads pinned to CPUs according to the scope, started together and timed individually
+class ThreadTeam {
+  public:
+    ThreadTeam(AtomicScope scope, size_t threadsCount) {
+        std::map<size_t, std::vector<size_t>> cpusPerL3Domain{};
+        for (const auto &cpu : CpuTopologyHelper::getAvailableCpus()) {
+            cpusPerL3Domain[cpu.l3DomainId].push_back(cpu.cpuIndex);
+        }
+
+        std::vector<size_t> orderedCpus{};
+        if (scope == AtomicScope::Workgroup) {
+            const auto largestDomain = std::max_element(cpusPerL3Domain.begin(), cpusPerL3Domain.end(),
+                                                        [](const auto &a, const auto &b) { return a.second.size() < b.second.size(); });
+            orderedCpus = largestDomain->second;
+        } else {
+            // Round robin over L3 domains, so that consecutive threads land in different domains
+            for (size_t index = 0; orderedCpus.size() < CpuTopologyHelper::getAvailableCpus().size(); index++) {
+                for (const auto &domain : cpusPerL3Domain) {
+                    if (index < domain.second.size()) {
+                        orderedCpus.push_back(domain.second[index]);
+                    }
+                }
+            }
+        }
+
+        threadsCount = threadsCount == 0 ? orderedCpus.size() : threadsCount;
+        for (size_t threadIndex = 0; threadIndex < threadsCount; threadIndex++) {
+            cpus.push_back(orderedCpus[threadIndex % orderedCpus.size()]);
+        }
+    }
+
+    size_t getThreadsCount() const {
+        return cpus.size();
+    }
+
+    // Returns the average time of a single iteration in nanoseconds across all threads
+    double run(size_t iterations, const std::function<void(size_t threadIndex, size_t iterations)> &work) {
+        std::atomic<size_t> readyThreads{0};
+        std::vector<double> threadTimesNs(cpus.size());
+        std::vector<std::thread> threads{};
+        for (size_t threadIndex = 0; threadIndex < cpus.size(); threadIndex++) {
+            threads.emplace_back([&, threadIndex]() {
+                CpuTopologyHelper::pinCurrentThread(cpus[threadIndex]);
+                readyThreads++;
+                while (readyThreads.load() != cpus.size()) {
+                }
+
+                const auto start = std::chrono::steady_clock::now();
+                work(threadIndex, iterations);
+                const auto end = std::chrono::steady_clock::now();
+                threadTimesNs[threadIndex] = std::chrono::duration<double, std::nano>(end - start).count();
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+
+        double totalTimeNs = 0;
+        for (double threadTimeNs : threadTimesNs) {
+            totalTimeNs += threadTimeNs;
+        }
+        return totalTimeNs / cpus.size() / iterations;
+    }
+
+  private:
+    std::vector<size_t> cpus{};
+};
+
+template <typename DataTypeT, std::memory_order order, typename Operation>
+static void compareExchangeLoop(std::atomic<DataTypeT> &address, Operation &&operation) {
+    DataTypeT expected = address.load(std::memory_order_relaxed);
+    while (!address.compare_exchange_weak(expected, operation(expected), order, std::memory_order_relaxed)) {
+    }
+}
+
+// Failure order of compare-exchange cannot contain release semantics
+constexpr std::memory_order getFailureOrder(std::memory_order order) {
+    switch (order) {
+    case std::memory_order_release:
+        return std::memory_order_relaxed;
+    case std::memory_order_acq_rel:
+        return std::memory_order_acquire;
+    default:
+        return order;
+    }
+}
+
+template <typename DataTypeT, std::memory_order order>
+static void performAtomics(MathOperation operation, std::atomic<DataTypeT> &address, DataTypeT other, size_t iterations) {
+    if constexpr (std::is_integral_v<DataTypeT>) {
+        switch (operation) {
+        case MathOperation::Add:
+            for (size_t i = 0; i < iterations; i++) {
+                address.fetch_add(other, order);
+            }
+            return;
+        case MathOperation::Sub:
+            for (size_t i = 0; i < iterations; i++) {
+                address.fetch_sub(other, order);
+            }
+            return;
+        case MathOperation::Inc:
+            for (size_t i = 0; i < iterations; i++) {
+                address.fetch_add(1, order);
+            }
+            return;
+        case MathOperation::Dec:
+            for (size_t i = 0; i < iterations; i++) {
+                address.fetch_sub(1, order);
+            }
+            return;
+        case MathOperation::And:
+            for (size_t i = 0; i < iterations; i++) {
+                address.fetch_and(other, order);
+            }
+            return;
+        case MathOperation::Or:
+            for (size_t i = 0; i < iterations; i++) {
+                address.fetch_or(other, order);
+            }
+            return;
+        case MathOperation::Xor:
+            for (size_t i = 0; i < iterations; i++) {
+                address.fetch_xor(other, order);
+            }
+            return;
+        case MathOperation::Min:
+            for (size_t i = 0; i < iterations; i++) {
+                compareExchangeLoop<DataTypeT, order>(address, [other](DataTypeT value) { return std::min(value, other); });
+            }
+            return;
+        case MathOperation::Max:
+            for (size_t i = 0; i < iterations; i++) {
+                compareExchangeLoop<DataTypeT, order>(address, [other](DataTypeT value) { return std::max(value, other); });
+            }
+            return;
+        default:
+            break;
+        }
+    } else {
+        // Floating point read-modify-write operations are emulated with compare-exchange
+        switch (operation) {
+        case MathOperation::Add:
+            for (size_t i = 0; i < iterations; i++) {
+                compareExchangeLoop<DataTypeT, order>(address, [other](DataTypeT value) { return value + other; });
+            }
+            return;
+        case MathOperation::Sub:
+            for (size_t i = 0; i < iterations; i++) {
+                compareExchangeLoop<DataTypeT, order>(address, [other](DataTypeT value) { return value - other; });
+            }
+            return;
+        default:
+            break;
+        }
+    }
+
+    switch (operation) {
+    case MathOperation::Xchg:
+        for (size_t i = 0; i < iterations; i++) {
+            address.exchange(other, order);
+        }
+        return;
+    case MathOperation::CmpXchg:
+        // Same as the GPU kernel - the comparison always fails, so the value is never changed
+        for (size_t i = 0; i < iterations; i++) {
+            DataTypeT expected = other;
+            address.compare_exchange_strong(expected, other, order, getFailureOrder(order));
+        }
+        return;
+    default:
+        FATAL_ERROR("Unknown atomic operation");
+    }
+}
+
+template <typename DataTypeT>
+static void performAtomics(AtomicMemoryOrder order, MathOperation operation, std::atomic<DataTypeT> &address, DataTypeT other, size_t iterations) {
+    switch (order) {
+    case AtomicMemoryOrder::Relaxed:
+        return performAtomics<DataTypeT, std::memory_order_relaxed>(operation, address, other, iterations);
+    case AtomicMemoryOrder::Acquire:
+        return performAtomics<DataTypeT, std::memory_order_acquire>(operation, address, other, iterations);
+    case AtomicMemoryOrder::Release:
+        return performAtomics<DataTypeT, std::memory_order_release>(operation, address, other, iterations);
+    case AtomicMemoryOrder::AcquireRelease:
+        return performAtomics<DataTypeT, std::memory_order_acq_rel>(operation, address, other, iterations);
+    case AtomicMemoryOrder::SequentialConsitent:
+        return performAtomics<DataTypeT, std::memory_order_seq_cst>(operation, address, other, iterations);
+    default:
+        FATAL_ERROR("Unknown atomic memory order");
+    }
+}
+
+struct AtomicsResult {
+    double nsPerOperation;
+    bool resultValid;
+};
+
+template <typename DataTypeT>
+static AtomicsResult measureAtomics(ThreadTeam &team, const HostAtomicBenchmarkArguments &arguments, Layout layout, AtomicMemoryOrder order) {
+    const size_t threadsCount = team.getThreadsCount();
+    const size_t addressesCount = layout == Layout::OneAtomic ? 1 : threadsCount;
+    const size_t threadsPerAddress = threadsCount / addressesCount;
+    const size_t stride = MemoryConstants::cachelineSize / arguments.atomicsPerCacheline;
+    const size_t cachelinesCount = (addressesCount + arguments.atomicsPerCacheline - 1) / arguments.atomicsPerCacheline;
+    const MathOperationTestData data = MathOperationHelper::generateTestData<DataTypeT>(arguments.atomicOperation, arguments.iterations, 1, threadsPerAddress);
+    DataTypeT initialValue{}, otherArgument{}, expectedValue{};
+    std::memcpy(&initialValue, data.initialValue, sizeof(DataTypeT));
+    std::memcpy(&otherArgument, data.otherArgument, sizeof(DataTypeT));
+    std::memcpy(&expectedValue, data.expectedValue, sizeof(DataTypeT));
+
+    struct alignas(MemoryConstants::cachelineSize) Cacheline {
+        std::byte data[MemoryConstants::cachelineSize];
+    };
+    auto cachelines = std::make_unique<Cacheline[]>(cachelinesCount);
+    const auto getAddress = [&](size_t addressIndex) {
+        return reinterpret_cast<std::atomic<DataTypeT> *>(reinterpret_cast<std::byte *>(cachelines.get()) + addressIndex * stride);
+    };
+
+    std::vector<double> results{};
+    bool resultValid = true;
+    for (size_t sample = 0; sample < arguments.samples; sample++) {
+        for (size_t addressIndex = 0; addressIndex < addressesCount; addressIndex++) {
+            new (getAddress(addressIndex)) std::atomic<DataTypeT>(initialValue);
+        }
+
+        results.push_back(team.run(arguments.iterations, [&](size_t threadIndex, size_t iterations) {
+            performAtomics<DataTypeT>(order, arguments.atomicOperation, *getAddress(threadIndex % addressesCount), otherArgument, iterations);
+        }));
+
+        for (size_t addressIndex = 0; addressIndex < addressesCount; addressIndex++) {
+            resultValid &= getAddress(addressIndex)->load() == expectedValue;
+        }
+    }
+
+    std::sort(results.begin(), results.end());
+    return {results[results.size() / 2], resultValid};
+}
+
+static void performFences(Fence fence, std::atomic<uint64_t> &address, size_t iterations) {
+    // Each iteration stores to thread-private memory, so fences are not hidden behind cache line transfers
+    const auto runLoop = [&](auto &&fenceFunction) {
+        for (size_t i = 0; i < iterations; i++) {
+            address.store(i, std::memory_order_relaxed);
+            fenceFunction();
+        }
+    };
+
+    switch (fence) {
+    case Fence::None:
+        return runLoop([]() {});
+    case Fence::Mfence:
+        return runLoop([]() { _mm_mfence(); });
+    case Fence::Sfence:
+        return runLoop([]() { _mm_sfence(); });
+    case Fence::Lfence:
+        return runLoop([]() { _mm_lfence(); });
+    case Fence::AtomicThreadFenceAcquire:
+        return runLoop([]() { std::atomic_thread_fence(std::memory_order_acquire); });
+    case Fence::AtomicThreadFenceRelease:
+        return runLoop([]() { std::atomic_thread_fence(std::memory_order_release); });
+    case Fence::AtomicThreadFenceAcquireRelease:
+        return runLoop([]() { std::atomic_thread_fence(std::memory_order_acq_rel); });
+    case Fence::AtomicThreadFenceSequentialConsistent:
+        return runLoop([]() { std::atomic_thread_fence(std::memory_order_seq_cst); });
+    }
+}
+
+static double measureFence(ThreadTeam &team, const HostAtomicBenchmarkArguments &arguments, Fence fence) {
+    struct alignas(MemoryConstants::cachelineSize) PrivateCacheline {
+        std::atomic<uint64_t> value;
+    };
+    std::vector<PrivateCacheline> cachelines(team.getThreadsCount());
+
+    std::vector<double> results{};
+    for (size_t sample = 0; sample < arguments.samples; sample++) {
+        results.push_back(team.run(arguments.iterations, [&](size_t threadIndex, size_t iterations) {
+            performFences(fence, cachelines[threadIndex].value, iterations);
+        }));
+    }
+    std::sort(results.begin(), results.end());
+    return results[results.size() / 2];
+}
+
+static std::string toString(AtomicMemoryOrder order) {
+    switch (order) {
+    case AtomicMemoryOrder::Relaxed:
+        return "relaxed";
+    case AtomicMemoryOrder::Acquire:
+        return "acquire";
+    case AtomicMemoryOrder::Release:
+        return "release";
+    case AtomicMemoryOrder::AcquireRelease:
+        return "acq_rel";
+    case AtomicMemoryOrder::SequentialConsitent:
+        return "seq_cst";
+    default:
+        FATAL_ERROR("Unknown atomic memory order");
+    }
+}
+
+int main(int argc, char **argv) {
+    CommandLineArguments commandLineArguments{};
+    std::string errorMessage{};
+    if (!CommandLineArgument::parseArguments(argc, argv, commandLineArguments, errorMessage)) {
+        std::cerr << errorMessage << std::endl;
+        return 1;
+    }
+
+    HostAtomicBenchmarkArguments arguments{};
+    arguments.parseArguments(commandLineArguments);
+    if (!CommandLineArgument::getUnprocessedArguments(commandLineArguments).empty() || !arguments.validateArguments()) {
+        std::cerr << "Error parsing command line\n";
+        return 1;
+    }
+    if (arguments.help) {
+        std::cout << "Measures the cost of atomic operations with each memory order and of memory fences on the host. Parameters:\n"
+                  << arguments.getHelp(1u);
+        return 0;
+    }
+
+    ThreadTeam team{arguments.scope, arguments.threads};
+    const int width = 20;
+    bool allResultsValid = true;
+
+    std::cout << "Atomic operations, " << team.getThreadsCount() << " threads [ns/op]\n"
+              << std::setw(width) << "order" << std::setw(width) << "OneAtomic" << std::setw(width) << "SeparateAtomics" << '\n';
+    for (AtomicMemoryOrder order : AtomicMemoryOrderHelper::allValues) {
+        std::cout << std::setw(width) << toString(order);
+        for (Layout layout : {Layout::OneAtomic, Layout::SeparateAtomics}) {
+            const AtomicsResult result = arguments.dataType == DataType::Float
+                                             ? measureAtomics<float>(team, arguments, layout, order)
+                                             : measureAtomics<int32_t>(team, arguments, layout, order);
+            std::cout << std::setw(width) << std::fixed << std::setprecision(2) << result.nsPerOperation << (result.resultValid ? "" : " (invalid)");
+            allResultsValid &= result.resultValid;
+        }
+        std::cout << '\n';
+    }
+
+    std::cout << "\nStore followed by a fence, " << team.getThreadsCount() << " threads [ns/iteration]\n";
+    for (const auto &fence : fences) {
+        std::cout << std::setw(2 * width) << fence.second
+                  << std::setw(width) << std::fixed << std::setprecision(2) << measureFence(team, arguments, fence.first) << '\n';
+    }
+
+    if (!allResultsValid) {
+        std::cerr << "Atomic operations produced invalid results\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,219 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <type_traits>
+#if defined(__ARM_ARCH)
+#include <sse2neon.h>
+#else
+#include <emmintrin.h>
+#endif
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#elif defined(_WIN32)
+#define NOMINMAX
+#include <Windows.h>
+#endif
+
+// Lock implementations compared by the tool. All of them satisfy the Lockable named requirement, so they
+// can be used with std::lock_guard. Only std::shared_mutex additionally provides shared (reader) locking.
+
+struct StdMutex : std::mutex {
+    constexpr static const char *name = "std_mutex";
+};
+
+struct StdSharedMutex : std::shared_mutex {
+    constexpr static const char *name = "std_shared_mutex";
+};
+
+// Test-and-test-and-set spinlock. After a failed attempt, the waiter backs off for an exponentially growing
+// number of pause instructions to reduce the traffic on the contended cache line.
+class SpinLockWithBackoff {
+  public:
+    constexpr static const char *name = "spinlock_backoff";
+
+    void lock() {
+        uint32_t backoff = minBackoff;
+        while (true) {
+            if (!locked.load(std::memory_order_relaxed) && !locked.exchange(true, std::memory_order_acquire)) {
+                return;
+            }
+            for (uint32_t i = 0; i < backoff; i++) {
+                _mm_pause();
+            }
+            backoff = std::min(backoff * 2, maxBackoff);
+        }
+    }
+
+    void unlock() {
+        locked.store(false, std::memory_order_release);
+    }
+
+  private:
+    constexpr static uint32_t minBackoff = 4;
+    constexpr static uint32_t maxBackoff = 1024;
+    std::atomic<bool> locked{false};
+};
+
+// FIFO spinlock. Each waiter takes a ticket and spins until it is served, which gives fairness
+// at the cost of all waiters polling the same cache line.
+class TicketLock {
+  public:
+    constexpr static const char *name = "ticket_lock";
+
+    void lock() {
+        const uint32_t ticket = nextTicket.fetch_add(1, std::memory_order_relaxed);
+        while (true) {
+            const uint32_t served = nowServing.load(std::memory_order_acquire);
+            if (served == ticket) {
+                return;
+            }
+            // Back off proportionally to the position in the queue
+            for (uint32_t i = 0; i < (ticket - served) * 8; i++) {
+                _mm_pause();
+            }
+        }
+    }
+
+    void unlock() {
+        nowServing.store(nowServing.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+  private:
+    alignas(64) std::atomic<uint32_t> nextTicket{0};
+    alignas(64) std::atomic<uint32_t> nowServing{0};
+};
+
+// MCS queue lock. Each waiter spins on a flag in its own queue node, so the lock handover touches only
+// the cache lines of two threads. Queue nodes are thread-local, so a thread may hold only one McsLock at a time.
+class McsLock {
+  public:
+    constexpr static const char *name = "mcs_lock";
+
+    void lock() {
+        Node &node = localNode;
+        node.next.store(nullptr, std::memory_order_relaxed);
+        node.locked.store(true, std::memory_order_relaxed);
+
+        Node *predecessor = tail.exchange(&node, std::memory_order_acq_rel);
+        if (predecessor != nullptr) {
+            predecessor->next.store(&node, std::memory_order_release);
+            while (node.locked.load(std::memory_order_acquire)) {
+                _mm_pause();
+            }
+        }
+    }
+
+    void unlock() {
+        Node &node = localNode;
+        Node *successor = node.next.load(std::memory_order_acquire);
+        if (successor == nullptr) {
+            Node *expected = &node;
+            if (tail.compare_exchange_strong(expected, nullptr, std::memory_order_acq_rel)) {
+                return;
+            }
+            // Some thread is enqueuing itself, wait until it links to our node
+            while ((successor = node.next.load(std::memory_order_acquire)) == nullptr) {
+                _mm_pause();
+            }
+        }
+        successor->locked.store(false, std::memory_order_release);
+    }
+
+  private:
+    struct alignas(64) Node {
+        std::atomic<Node *> next;
+        std::atomic<bool> locked;
+    };
+    static inline thread_local Node localNode{};
+    alignas(64) std::atomic<Node *> tail{nullptr};
+};
+
+// Three-state mutex (unlocked, locked, locked with waiters) described by U. Drepper in "Futexes Are Tricky".
+// Uncontended paths are a single atomic operation, contended waiters sleep in the kernel. Waiting and waking
+// is delegated to the derived class, so the same algorithm can be used with different OS primitives.
+template <typename Derived>
+class ThreeStateMutex {
+  public:
+    void lock() {
+        uint32_t state = Unlocked;
+        if (this->state.compare_exchange_strong(state, Locked, std::memory_order_acquire)) {
+            return;
+        }
+        if (state != Contended) {
+            state = this->state.exchange(Contended, std::memory_order_acquire);
+        }
+        while (state != Unlocked) {
+            static_cast<Derived *>(this)->wait(Contended);
+            state = this->state.exchange(Contended, std::memory_order_acquire);
+        }
+    }
+
+    void unlock() {
+        if (state.exchange(Unlocked, std::memory_order_release) == Contended) {
+            static_cast<Derived *>(this)->wakeOne();
+        }
+    }
+
+  protected:
+    constexpr static uint32_t Unlocked = 0;
+    constexpr static uint32_t Locked = 1;
+    constexpr static uint32_t Contended = 2;
+    std::atomic<uint32_t> state{Unlocked};
+    static_assert(sizeof(state) == sizeof(uint32_t), "Futex word must be 32 bits wide");
+};
+
+class FutexMutex : public ThreeStateMutex<FutexMutex> {
+  public:
+    constexpr static const char *name = "futex_mutex";
+
+    void wait(uint32_t expectedValue) {
+#if defined(__linux__)
+        syscall(SYS_futex, reinterpret_cast<uint32_t *>(&state), FUTEX_WAIT_PRIVATE, expectedValue, nullptr, nullptr, 0);
+#elif defined(_WIN32)
+        WaitOnAddress(&state, &expectedValue, sizeof(expectedValue), INFINITE);
+#else
+        (void)expectedValue;
+        std::this_thread::yield();
+#endif
+    }
+
+    void wakeOne() {
+#if defined(__linux__)
+        syscall(SYS_futex, reinterpret_cast<uint32_t *>(&state), FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+#elif defined(_WIN32)
+        WakeByAddressSingle(&state);
+#endif
+    }
+};
+
+#if defined(__cpp_lib_atomic_wait)
+class AtomicWaitMutex : public ThreeStateMutex<AtomicWaitMutex> {
+  public:
+    constexpr static const char *name = "atomic_wait_mutex";
+
+    void wait(uint32_t expectedValue) {
+        state.wait(expectedValue, std::memory_order_relaxed);
+    }
+
+    void wakeOne() {
+        state.notify_one();
+    }
+};
+#endif
+
+template <typename LockT>
+constexpr inline bool supportsSharedLocking = std::is_same_v<LockT, StdSharedMutex>;
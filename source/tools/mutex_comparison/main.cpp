@@ -1,72 +1,286 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
+#include "framework/argument/argument_container.h"
+#include "framework/argument/basic_argument.h"
+#include "framework/argument/boolean_flag_argument.h"
+#include "framework/argument/string_list_argument.h"
+#include "framework/utility/cpu_topology_helper.h"
+
+#include "locks.h"
+
 #include <algorithm>
 #include <chrono>
+#include <iomanip>
 #include <iostream>
-#include <mutex>
 #include <numeric>
-#include <shared_mutex>
+#include <random>
+#include <thread>
 #include <vector>
 
-constexpr uint32_t comparisonIterations = 100;
-constexpr uint32_t lockIterations = 100000;
+// Compares synchronization primitives under a configurable amount of contention. Every thread performs
+// a number of acquisitions of a single lock, doing some work inside and outside of the critical section.
+// A fraction of acquisitions can be readers, which take a shared lock when the primitive supports it.
+// Reported are total throughput and percentiles of the time spent waiting for the lock.
 
-void printMutexTimes(std::vector<double> &vec) {
-    auto sum = std::accumulate(vec.begin(), vec.end(), 0.0);
-    auto avg = sum / comparisonIterations;
-    auto [minIt, maxIt] = std::minmax_element(vec.begin(), vec.end());
-    auto min = *minIt;
-    auto max = *maxIt;
-    std::cout << "Min: " << min << " ns, Max: " << max << " ns, Avg: " << avg << " ns" << std::endl;
-}
+struct MutexComparisonArguments : ArgumentContainer {
+    BooleanFlagArgument help;
+    StringListArgument threads;
+    StringListArgument readPercentages;
+    StringListArgument locks;
+    PositiveIntegerArgument acquisitions;
+    NonNegativeIntegerArgument criticalSectionWork;
+    NonNegativeIntegerArgument nonCriticalSectionWork;
+    BooleanArgument pinThreads;
+
+    MutexComparisonArguments()
+        : help(*this, "help", "Shows this message"),
+          threads(*this, "threads", "Space separated list of thread counts to sweep. Default is \"1 2 4 8\""),
+          readPercentages(*this, "readPercentages", "Space separated list of percentages of acquisitions being reads. Default is \"0 90\""),
+          locks(*this, "locks", "Space separated list of lock names. All locks are compared by default"),
+          acquisitions(*this, "acquisitions", "Lock acquisitions performed by each thread"),
+          criticalSectionWork(*this, "criticalSectionWork", "Pause instructions executed while holding the lock"),
+          nonCriticalSectionWork(*this, "nonCriticalSectionWork", "Pause instructions executed between acquisitions"),
+          pinThreads(*this, "pinThreads", "Pin each thread to a different CPU") {
+        help = false;
+        threads = std::vector<std::string>{};
+        readPercentages = std::vector<std::string>{};
+        locks = std::vector<std::string>{};
+        acquisitions = 100000;
+        criticalSectionWork = 10;
+        nonCriticalSectionWork = 50;
+        pinThreads = true;
+    }
+};
+
+struct TestConfiguration {
+    size_t threadsCount;
+    size_t readPercentage;
+    size_t acquisitions;
+    size_t criticalSectionWork;
+    size_t nonCriticalSectionWork;
+    bool pinThreads;
+};
 
-int main() {
-    std::shared_mutex sharedMtx;
-    std::mutex mtx;
+struct TestResults {
+    double throughputMops;
+    std::vector<uint64_t> waitTimesNs;
+    bool valid;
+};
 
-    std::vector<double> sharedMtxSharedTimes;
-    std::vector<double> sharedMtxExclusiveTimes;
-    std::vector<double> mtxTimes;
+static void doWork(size_t pauses) {
+    for (size_t i = 0; i < pauses; i++) {
+        _mm_pause();
+    }
+}
+
+template <typename LockT>
+static TestResults runTest(const TestConfiguration &configuration, const std::vector<CpuTopologyHelper::CpuInfo> &cpus) {
+    using Clock = std::chrono::steady_clock;
 
-    std::cout << "--- Comparison start ---" << std::endl;
+    LockT lock{};
+    uint64_t protectedCounter = 0;
+    std::atomic<uint64_t> expectedCounter{0};
+    std::atomic<size_t> readyThreads{0};
+    std::atomic<bool> start{false};
+    std::vector<std::vector<uint64_t>> waitTimesPerThread(configuration.threadsCount);
 
-    for (uint32_t j = 0; j < comparisonIterations; j++) {
-        auto start = std::chrono::steady_clock::now();
-        for (uint32_t i = 0; i < lockIterations; i++) {
-            sharedMtx.lock_shared();
-            sharedMtx.unlock_shared();
+    const auto threadBody = [&](size_t threadIndex) {
+        if (configuration.pinThreads && !cpus.empty()) {
+            CpuTopologyHelper::pinCurrentThread(cpus[threadIndex % cpus.size()].cpuIndex);
         }
-        auto end = std::chrono::steady_clock::now();
-        sharedMtxSharedTimes.push_back((std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()) / static_cast<double>(lockIterations));
 
-        start = std::chrono::steady_clock::now();
-        for (uint32_t i = 0; i < lockIterations; i++) {
-            sharedMtx.lock();
-            sharedMtx.unlock();
+        std::mt19937 generator{static_cast<uint32_t>(threadIndex)};
+        std::uniform_int_distribution<size_t> distribution{0, 99};
+        std::vector<uint64_t> &waitTimes = waitTimesPerThread[threadIndex];
+        waitTimes.reserve(configuration.acquisitions);
+        uint64_t writesCount = 0;
+
+        readyThreads++;
+        while (!start.load(std::memory_order_acquire)) {
         }
-        end = std::chrono::steady_clock::now();
-        sharedMtxExclusiveTimes.push_back((std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()) / static_cast<double>(lockIterations));
 
-        start = std::chrono::steady_clock::now();
-        for (uint32_t i = 0; i < lockIterations; i++) {
-            mtx.lock();
-            mtx.unlock();
+        for (size_t i = 0; i < configuration.acquisitions; i++) {
+            const bool isRead = distribution(generator) < configuration.readPercentage;
+            const auto lockStart = Clock::now();
+            if constexpr (supportsSharedLocking<LockT>) {
+                if (isRead) {
+                    lock.lock_shared();
+                } else {
+                    lock.lock();
+                }
+            } else {
+                lock.lock();
+            }
+            const auto lockEnd = Clock::now();
+            waitTimes.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(lockEnd - lockStart).count());
+
+            if (isRead) {
+                volatile uint64_t readValue = protectedCounter;
+                (void)readValue;
+            } else {
+                protectedCounter++;
+                writesCount++;
+            }
+            doWork(configuration.criticalSectionWork);
+
+            if constexpr (supportsSharedLocking<LockT>) {
+                if (isRead) {
+                    lock.unlock_shared();
+                } else {
+                    lock.unlock();
+                }
+            } else {
+                lock.unlock();
+            }
+            doWork(configuration.nonCriticalSectionWork);
         }
-        end = std::chrono::steady_clock::now();
-        mtxTimes.push_back((std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()) / static_cast<double>(lockIterations));
+        expectedCounter += writesCount;
+    };
+
+    std::vector<std::thread> threads{};
+    for (size_t threadIndex = 0; threadIndex < configuration.threadsCount; threadIndex++) {
+        threads.emplace_back(threadBody, threadIndex);
+    }
+    while (readyThreads.load() != configuration.threadsCount) {
+        std::this_thread::yield();
+    }
+    const auto startTime = Clock::now();
+    start.store(true, std::memory_order_release);
+    for (auto &thread : threads) {
+        thread.join();
     }
+    const auto endTime = Clock::now();
 
-    std::cout << "Shared mutex - shared lock:  ";
-    printMutexTimes(sharedMtxSharedTimes);
-    std::cout << "Shared mutex exclusive lock: ";
-    printMutexTimes(sharedMtxExclusiveTimes);
-    std::cout << "Mutex - exclusive lock:      ";
-    printMutexTimes(mtxTimes);
+    TestResults results{};
+    const double totalAcquisitions = static_cast<double>(configuration.threadsCount * configuration.acquisitions);
+    const double elapsedUs = std::chrono::duration<double, std::micro>(endTime - startTime).count();
+    results.throughputMops = totalAcquisitions / elapsedUs;
+    for (const auto &waitTimes : waitTimesPerThread) {
+        results.waitTimesNs.insert(results.waitTimesNs.end(), waitTimes.begin(), waitTimes.end());
+    }
+    results.valid = protectedCounter == expectedCounter.load();
+    return results;
+}
 
-    return 0;
-}
\ No newline at end of file
+static uint64_t getPercentile(const std::vector<uint64_t> &sortedValues, double percentile) {
+    const size_t index = static_cast<size_t>(percentile / 100.0 * (sortedValues.size() - 1));
+    return sortedValues[index];
+}
+
+static void printHeader() {
+    std::cout << std::setw(20) << "Lock"
+              << std::setw(9) << "Threads"
+              << std::setw(7) << "Read%"
+              << std::setw(14) << "Mops/s"
+              << std::setw(10) << "p50[ns]"
+              << std::setw(10) << "p90[ns]"
+              << std::setw(10) << "p99[ns]"
+              << std::setw(11) << "p99.9[ns]"
+              << std::setw(12) << "max[ns]" << '\n';
+}
+
+static void printResults(const char *lockName, const TestConfiguration &configuration, TestResults &results) {
+    std::sort(results.waitTimesNs.begin(), results.waitTimesNs.end());
+    std::cout << std::setw(20) << lockName
+              << std::setw(9) << configuration.threadsCount
+              << std::setw(7) << configuration.readPercentage
+              << std::setw(14) << std::fixed << std::setprecision(3) << results.throughputMops
+              << std::setw(10) << getPercentile(results.waitTimesNs, 50)
+              << std::setw(10) << getPercentile(results.waitTimesNs, 90)
+              << std::setw(10) << getPercentile(results.waitTimesNs, 99)
+              << std::setw(11) << getPercentile(results.waitTimesNs, 99.9)
+              << std::setw(12) << results.waitTimesNs.back();
+    if (!results.valid) {
+        std::cout << "  ERROR: lost updates detected";
+    }
+    std::cout << '\n';
+}
+
+template <typename LockT>
+static bool runIfSelected(const std::vector<std::string> &selectedLocks, const TestConfiguration &configuration, const std::vector<CpuTopologyHelper::CpuInfo> &cpus) {
+    const bool selected = std::find(selectedLocks.begin(), selectedLocks.end(), "all") != selectedLocks.end() ||
+                          std::find(selectedLocks.begin(), selectedLocks.end(), LockT::name) != selectedLocks.end();
+    if (!selected) {
+        return true;
+    }
+
+    TestResults results = runTest<LockT>(configuration, cpus);
+    printResults(LockT::name, configuration, results);
+    return results.valid;
+}
+
+static std::vector<size_t> parseNumbers(const std::vector<std::string> &strings, std::vector<size_t> defaultValues) {
+    if (strings.empty()) {
+        return defaultValues;
+    }
+
+    std::vector<size_t> result{};
+    for (const auto &string : strings) {
+        result.push_back(static_cast<size_t>(std::atoll(string.c_str())));
+    }
+    return result;
+}
+
+int main(int argc, char **argv) {
+    CommandLineArguments commandLineArguments{};
+    std::string errorMessage{};
+    if (!CommandLineArgument::parseArguments(argc, argv, commandLineArguments, errorMessage)) {
+        std::cerr << errorMessage << std::endl;
+        return 1;
+    }
+
+    MutexComparisonArguments arguments{};
+    arguments.parseArguments(commandLineArguments);
+    if (!CommandLineArgument::getUnprocessedArguments(commandLineArguments).empty() || !arguments.validateArguments()) {
+        std::cerr << "Error parsing command line\n";
+        return 1;
+    }
+    if (arguments.help) {
+        std::cout << "Compares throughput and acquire latency of synchronization primitives under contention. Available locks: "
+                  << StdMutex::name << ", " << StdSharedMutex::name << ", " << SpinLockWithBackoff::name << ", " << TicketLock::name << ", "
+                  << McsLock::name << ", " << FutexMutex::name
+#if defined(__cpp_lib_atomic_wait)
+                  << ", " << AtomicWaitMutex::name
+#endif
+                  << ". Parameters:\n"
+                  << arguments.getHelp(1u);
+        return 0;
+    }
+
+    const auto cpus = CpuTopologyHelper::getAvailableCpus();
+    std::vector<std::string> selectedLocks = arguments.locks;
+    if (selectedLocks.empty()) {
+        selectedLocks.push_back("all");
+    }
+    bool allValid = true;
+
+    printHeader();
+    for (const size_t threadsCount : parseNumbers(arguments.threads, {1, 2, 4, 8})) {
+        for (const size_t readPercentage : parseNumbers(arguments.readPercentages, {0, 90})) {
+            TestConfiguration configuration{};
+            configuration.threadsCount = std::max(threadsCount, size_t{1});
+            configuration.readPercentage = std::min(readPercentage, size_t{100});
+            configuration.acquisitions = arguments.acquisitions;
+            configuration.criticalSectionWork = arguments.criticalSectionWork;
+            configuration.nonCriticalSectionWork = arguments.nonCriticalSectionWork;
+            configuration.pinThreads = arguments.pinThreads;
+
+            allValid &= runIfSelected<StdMutex>(selectedLocks, configuration, cpus);
+            allValid &= runIfSelected<StdSharedMutex>(selectedLocks, configuration, cpus);
+            allValid &= runIfSelected<SpinLockWithBackoff>(selectedLocks, configuration, cpus);
+            allValid &= runIfSelected<TicketLock>(selectedLocks, configuration, cpus);
+            allValid &= runIfSelected<McsLock>(selectedLocks, configuration, cpus);
+            allValid &= runIfSelected<FutexMutex>(selectedLocks, configuration, cpus);
+#if defined(__cpp_lib_atomic_wait)
+            allValid &= runIfSelected<AtomicWaitMutex>(selectedLocks, configuration, cpus);
+#endif
+        }
+    }
+
+    return allValid ? 0 : 1;
+}
@@ -0,0 +1,239 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/argument/argument_container.h"
+#include "framework/argument/basic_argument.h"
+#include "framework/argument/boolean_flag_argument.h"
+#include "framework/argument/string_argument.h"
+#include "framework/utility/result_history.h"
+
+#include <algorithm>
+#include <cmath>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+// Queries result history written by benchmarks run with --history. By default it looks for change points in the
+// median of every configuration, i.e. moments after which results are consistently different than before, and
+// prints when they happened along with the benchmark version. This points at the driver drop which caused
+// a regression or an improvement, without being misled by single noisy runs.
+
+struct ResultHistoryArguments : ArgumentContainer {
+    BooleanFlagArgument help;
+    StringArgument file;
+    StringArgument filter;
+    BooleanFlagArgument list;
+    BooleanFlagArgument trend;
+    NonNegativeIntegerArgument minShift;
+    PositiveIntegerArgument minScore;
+    PositiveIntegerArgument minSegment;
+
+    ResultHistoryArguments()
+        : help(*this, "help", "Shows this message"),
+          file(*this, "file", "History file written by benchmarks run with --history"),
+          filter(*this, "filter", "Only show configurations containing a given string in benchmark name, test name, arguments or label"),
+          list(*this, "list", "List all configurations with the number of results"),
+          trend(*this, "trend", "Print all results of each configuration in chronological order"),
+          minShift(*this, "minShift", "Minimal relative change of median, in percents, reported as a change point"),
+          minScore(*this, "minScore", "Minimal ratio of a change to its noise (a t-statistic) reported as a change point"),
+          minSegment(*this, "minSegment", "Minimal number of results before and after a change point, at least 2") {
+        help = false;
+        file = "";
+        filter = "";
+        list = false;
+        trend = false;
+        minShift = 5;
+        minScore = 4;
+        minSegment = 3;
+    }
+
+    bool validateArgumentsExtra() const override {
+        // Noise of a split is estimated from deviations within both segments, which needs at least one degree of freedom
+        if (minSegment < 2) {
+            std::cerr << "--minSegment has to be at least 2\n";
+            return false;
+        }
+        return true;
+    }
+};
+
+using Series = std::vector<const ResultHistoryEntry *>;
+
+struct ChangePointParameters {
+    double minRelativeShift;
+    double minScore;
+    size_t minSegment;
+};
+
+double calculateMean(const std::vector<double> &values, size_t begin, size_t end) {
+    double sum = 0;
+    for (size_t index = begin; index < end; index++) {
+        sum += values[index];
+    }
+    return sum / (end - begin);
+}
+
+// Binary segmentation: find the split which best separates the series into two parts with different means,
+// accept it if it is significant and recurse into both parts.
+void detectChangePoints(const std::vector<double> &values, size_t begin, size_t end, const ChangePointParameters &parameters, std::vector<size_t> &changePoints) {
+    if (end - begin < 2 * parameters.minSegment) {
+        return;
+    }
+
+    size_t bestSplit = 0;
+    double bestScore = 0;
+    for (size_t split = begin + parameters.minSegment; split + parameters.minSegment <= end; split++) {
+        const double leftMean = calculateMean(values, begin, split);
+        const double rightMean = calculateMean(values, split, end);
+        double squaredDeviations = 0;
+        for (size_t index = begin; index < end; index++) {
+            const double mean = index < split ? leftMean : rightMean;
+            squaredDeviations += (values[index] - mean) * (values[index] - mean);
+        }
+
+        const double leftCount = static_cast<double>(split - begin);
+        const double rightCount = static_cast<double>(end - split);
+        const double pooledVariance = squaredDeviations / (end - begin - 2);
+        const double standardError = std::sqrt(pooledVariance * (1 / leftCount + 1 / rightCount));
+        const double difference = std::abs(rightMean - leftMean);
+        const double relativeShift = leftMean != 0 ? difference / std::abs(leftMean) : 0;
+        if (relativeShift < parameters.minRelativeShift) {
+            continue;
+        }
+        const double score = standardError > 0 ? difference / standardError : std::numeric_limits<double>::infinity();
+        if (score > bestScore) {
+            bestScore = score;
+            bestSplit = split;
+        }
+    }
+
+    if (bestSplit == 0 || bestScore < parameters.minScore) {
+        return;
+    }
+    detectChangePoints(values, begin, bestSplit, parameters, changePoints);
+    changePoints.push_back(bestSplit);
+    detectChangePoints(values, bestSplit, end, parameters, changePoints);
+}
+
+std::string formatTime(uint64_t unixTimeSeconds) {
+    const std::time_t time = static_cast<std::time_t>(unixTimeSeconds);
+    std::ostringstream result{};
+    result << std::put_time(std::localtime(&time), "%Y-%m-%d %H:%M");
+    return result.str();
+}
+
+void printSeriesName(const Series &series) {
+    const ResultHistoryEntry &entry = *series.front();
+    std::cout << entry.benchmarkName << ' ' << entry.configuration << ' ' << entry.type << ' ' << entry.label << '\n';
+}
+
+void printTrend(const Series &series) {
+    printSeriesName(series);
+    const int width = 15;
+    std::cout << std::setw(20) << "Time" << std::setw(30) << "Version" << std::setw(width) << "Median" << std::setw(width) << "Mean" << std::setw(width) << "StdDev" << '\n';
+    for (const ResultHistoryEntry *entry : series) {
+        std::cout << std::setw(20) << formatTime(entry->unixTimeSeconds) << std::setw(30) << entry->benchmarkVersion
+                  << std::fixed << std::setprecision(3) << std::setw(width) << entry->median << std::setw(width) << entry->mean
+                  << std::setw(width - 1) << 100 * entry->relativeStandardDeviation << "%\n";
+    }
+    std::cout << '\n';
+}
+
+bool printChangePoints(const Series &series, const ChangePointParameters &parameters) {
+    std::vector<double> medians{};
+    for (const ResultHistoryEntry *entry : series) {
+        medians.push_back(entry->median);
+    }
+
+    std::vector<size_t> changePoints{};
+    detectChangePoints(medians, 0, medians.size(), parameters, changePoints);
+    if (changePoints.empty()) {
+        return false;
+    }
+
+    printSeriesName(series);
+    changePoints.push_back(medians.size());
+    size_t segmentBegin = 0;
+    for (size_t changePointIndex = 0; changePointIndex + 1 < changePoints.size(); changePointIndex++) {
+        const size_t changePoint = changePoints[changePointIndex];
+        const double before = calculateMean(medians, segmentBegin, changePoint);
+        const double after = calculateMean(medians, changePoint, changePoints[changePointIndex + 1]);
+        const ResultHistoryEntry &entry = *series[changePoint];
+        std::cout << "  " << formatTime(entry.unixTimeSeconds) << " (version " << entry.benchmarkVersion << "): median "
+                  << std::fixed << std::setprecision(3) << before << " -> " << after
+                  << " (" << std::showpos << std::setprecision(1) << 100 * (after - before) / before << std::noshowpos << "%)\n";
+        segmentBegin = changePoint;
+    }
+    std::cout << '\n';
+    return true;
+}
+
+int main(int argc, char **argv) {
+    CommandLineArguments commandLineArguments{};
+    std::string errorMessage{};
+    if (!CommandLineArgument::parseArguments(argc, argv, commandLineArguments, errorMessage)) {
+        std::cerr << errorMessage << std::endl;
+        return 1;
+    }
+
+    ResultHistoryArguments arguments{};
+    arguments.parseArguments(commandLineArguments);
+    if (!CommandLineArgument::getUnprocessedArguments(commandLineArguments).empty() || !arguments.validateArguments()) {
+        std::cerr << "Error parsing command line\n";
+        return 1;
+    }
+    if (arguments.help || static_cast<const std::string &>(arguments.file).empty()) {
+        std::cout << "Shows trends and change points in results stored by benchmarks run with --history. Parameters:\n"
+                  << arguments.getHelp(1u);
+        return arguments.help ? 0 : 1;
+    }
+
+    std::vector<ResultHistoryEntry> entries{};
+    if (!ResultHistory::load(arguments.file, entries, errorMessage)) {
+        std::cerr << "Could not read " << static_cast<const std::string &>(arguments.file) << ": " << errorMessage << '\n';
+        return 1;
+    }
+
+    // Group results into series of the same configuration, sorted by time
+    const std::string &filter = arguments.filter;
+    std::map<std::string, Series> seriesMap{};
+    for (const auto &entry : entries) {
+        const std::string key = entry.getSeriesKey();
+        if (key.find(filter) != std::string::npos) {
+            seriesMap[key].push_back(&entry);
+        }
+    }
+    for (auto &[key, series] : seriesMap) {
+        std::stable_sort(series.begin(), series.end(), [](const auto *a, const auto *b) { return a->unixTimeSeconds < b->unixTimeSeconds; });
+    }
+
+    if (arguments.list) {
+        for (const auto &[key, series] : seriesMap) {
+            std::cout << std::setw(8) << series.size() << "  " << key << '\n';
+        }
+        return 0;
+    }
+
+    if (arguments.trend) {
+        for (const auto &[key, series] : seriesMap) {
+            printTrend(series);
+        }
+        return 0;
+    }
+
+    const ChangePointParameters parameters{arguments.minShift / 100.0, static_cast<double>(arguments.minScore), static_cast<size_t>(arguments.minSegment)};
+    size_t changedSeriesCount = 0;
+    for (const auto &[key, series] : seriesMap) {
+        changedSeriesCount += printChangePoints(series, parameters);
+    }
+    std::cout << changedSeriesCount << " of " << seriesMap.size() << " configurations changed\n";
+    return 0;
+}
@@ -0,0 +1,282 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/argument/argument_container.h"
+#include "framework/argument/basic_argument.h"
+#include "framework/argument/boolean_flag_argument.h"
+#include "framework/argument/enum/wait_strategy_argument.h"
+#include "framework/utility/cpu_topology_helper.h"
+#include "framework/utility/wait_helper.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+// Host-only model of the ULLS doorbell protocol. A producer writes commands into a ring buffer and publishes them
+// by moving the tail pointer, a consumer polls the tail, reads the commands and moves the head pointer back.
+// The time between the producer starting to write a batch and the consumer seeing each command is reported, which
+// is a lower bound for submission latencies measured by BestSubmission, RoundTripSubmission or CompletionLatency.
+
+struct RingBufferSubmissionArguments : ArgumentContainer {
+    BooleanFlagArgument help;
+    PositiveIntegerArgument submissions;
+    PositiveIntegerArgument ringEntries;
+    PositiveIntegerArgument batchSize;
+    NonNegativeIntegerArgument submitIntervalUs;
+    BooleanArgument separateCacheLines;
+    BooleanArgument nonTemporalStores;
+    BooleanArgument crossProcess;
+    NonNegativeIntegerArgument producerCpu;
+    NonNegativeIntegerArgument consumerCpu;
+    WaitStrategyArgument waitStrategy;
+
+    RingBufferSubmissionArguments()
+        : help(*this, "help", "Shows this message"),
+          submissions(*this, "submissions", "Number of batches submitted by the producer"),
+          ringEntries(*this, "ringEntries", "Number of 64-byte command slots in the ring, rounded up to a power of 2"),
+          batchSize(*this, "batchSize", "Commands written before each tail update"),
+          submitIntervalUs(*this, "submitIntervalUs", "Delay between consecutive batches. 0 submits back-to-back"),
+          separateCacheLines(*this, "separateCacheLines", "Place head and tail pointers in separate cache lines"),
+          nonTemporalStores(*this, "nonTemporalStores", "Write commands with non-temporal stores, as done for write-combined rings"),
+          crossProcess(*this, "crossProcess", "Run the consumer in a separate process, sharing the ring through shared memory"),
+          producerCpu(*this, "producerCpu", "CPU the producer is pinned to"),
+          consumerCpu(*this, "consumerCpu", "CPU the consumer is pinned to"),
+          waitStrategy(*this, "waitStrategy", "Method used by the consumer to poll the tail pointer") {
+        help = false;
+        submissions = 10000;
+        ringEntries = 256;
+        batchSize = 1;
+        submitIntervalUs = 10;
+        separateCacheLines = true;
+        nonTemporalStores = false;
+        crossProcess = false;
+        producerCpu = 0;
+        consumerCpu = 1;
+        waitStrategy = WaitStrategy::Spin;
+    }
+
+    bool validateArgumentsExtra() const override {
+#if !defined(__linux__)
+        if (crossProcess) {
+            std::cerr << "Cross process placement is supported only on Linux\n";
+            return false;
+        }
+#endif
+        return true;
+    }
+};
+
+constexpr static size_t cacheLineSize = 64;
+
+struct alignas(cacheLineSize) Command {
+    uint64_t sequence;
+    int64_t submitTimestampNs;
+    uint64_t payload[6];
+};
+static_assert(sizeof(Command) == cacheLineSize);
+
+// Shared state of the ring, placed in memory visible to both producer and consumer. Head and tail are either
+// next to each other or in separate cache lines, depending on the configuration.
+struct RingLayout {
+    volatile uint64_t *head;
+    volatile uint64_t *tail;
+    Command *commands;
+    int64_t *latenciesNs;
+    uint64_t ringMask;
+
+    static size_t getRequiredSize(uint64_t ringEntries, uint64_t commandsCount) {
+        return 2 * cacheLineSize + ringEntries * sizeof(Command) + commandsCount * sizeof(int64_t);
+    }
+
+    static RingLayout create(std::byte *memory, uint64_t ringEntries, bool separateCacheLines) {
+        RingLayout layout{};
+        layout.head = reinterpret_cast<volatile uint64_t *>(memory);
+        layout.tail = reinterpret_cast<volatile uint64_t *>(memory + (separateCacheLines ? cacheLineSize : sizeof(uint64_t)));
+        layout.commands = reinterpret_cast<Command *>(memory + 2 * cacheLineSize);
+        layout.latenciesNs = reinterpret_cast<int64_t *>(memory + 2 * cacheLineSize + ringEntries * sizeof(Command));
+        layout.ringMask = ringEntries - 1;
+        return layout;
+    }
+};
+
+using Clock = std::chrono::steady_clock;
+
+static int64_t getTimestampNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+}
+
+static void writeCommand(Command *slot, const Command &command, bool nonTemporalStores) {
+    if (nonTemporalStores) {
+        const __m128i *source = reinterpret_cast<const __m128i *>(&command);
+        __m128i *destination = reinterpret_cast<__m128i *>(slot);
+        for (size_t i = 0; i < sizeof(Command) / sizeof(__m128i); i++) {
+            _mm_stream_si128(destination + i, _mm_load_si128(source + i));
+        }
+    } else {
+        *slot = command;
+    }
+}
+
+static void runProducer(RingLayout ring, const RingBufferSubmissionArguments &arguments) {
+    CpuTopologyHelper::pinCurrentThread(arguments.producerCpu);
+    const uint64_t batchSize = arguments.batchSize;
+    const uint64_t ringEntries = ring.ringMask + 1;
+    const auto submitInterval = std::chrono::microseconds(static_cast<size_t>(arguments.submitIntervalUs));
+
+    uint64_t tail = 0;
+    auto nextSubmission = Clock::now();
+    for (uint64_t submission = 0; submission < arguments.submissions; submission++) {
+        while (Clock::now() < nextSubmission) {
+        }
+        nextSubmission += submitInterval;
+
+        // Wait for space in the ring
+        while (tail + batchSize - *ring.head > ringEntries) {
+            _mm_pause();
+        }
+
+        const int64_t submitTimestampNs = getTimestampNs();
+        for (uint64_t i = 0; i < batchSize; i++) {
+            Command command{};
+            command.sequence = tail + i;
+            command.submitTimestampNs = submitTimestampNs;
+            writeCommand(&ring.commands[(tail + i) & ring.ringMask], command, arguments.nonTemporalStores);
+        }
+
+        // Ring the doorbell. Non-temporal stores are weakly ordered and have to be fenced explicitly.
+        if (arguments.nonTemporalStores) {
+            _mm_sfence();
+        }
+        std::atomic_thread_fence(std::memory_order_release);
+        tail += batchSize;
+        *ring.tail = tail;
+    }
+}
+
+static void runConsumer(RingLayout ring, const RingBufferSubmissionArguments &arguments) {
+    CpuTopologyHelper::pinCurrentThread(arguments.consumerCpu);
+    const uint64_t commandsCount = arguments.submissions * arguments.batchSize;
+
+    uint64_t head = 0;
+    while (head < commandsCount) {
+        WaitHelper::waitWhileEqual(ring.tail, head, arguments.waitStrategy);
+        const uint64_t tail = *ring.tail;
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        const int64_t observedTimestampNs = getTimestampNs();
+        for (; head < tail; head++) {
+            const Command &command = ring.commands[head & ring.ringMask];
+            FATAL_ERROR_IF(command.sequence != head, "Ring buffer entry was not written before the tail update");
+            ring.latenciesNs[head] = observedTimestampNs - command.submitTimestampNs;
+        }
+        std::atomic_thread_fence(std::memory_order_release);
+        *ring.head = head;
+    }
+}
+
+#if defined(__linux__)
+static void runCrossProcess(RingLayout ring, const RingBufferSubmissionArguments &arguments) {
+    const pid_t childPid = fork();
+    FATAL_ERROR_IF(childPid == -1, "Creating consumer process failed");
+    if (childPid == 0) {
+        runConsumer(ring, arguments);
+        _exit(0);
+    }
+
+    runProducer(ring, arguments);
+    int status{};
+    FATAL_ERROR_IF(waitpid(childPid, &status, 0) != childPid, "Waiting for consumer process failed");
+    FATAL_ERROR_IF(!WIFEXITED(status) || WEXITSTATUS(status) != 0, "Consumer process failed");
+}
+#endif
+
+static uint64_t roundUpToPowerOfTwo(uint64_t value) {
+    uint64_t result = 1;
+    while (result < value) {
+        result *= 2;
+    }
+    return result;
+}
+
+int main(int argc, char **argv) {
+    CommandLineArguments commandLineArguments{};
+    std::string errorMessage{};
+    if (!CommandLineArgument::parseArguments(argc, argv, commandLineArguments, errorMessage)) {
+        std::cerr << errorMessage << std::endl;
+        return 1;
+    }
+
+    RingBufferSubmissionArguments arguments{};
+    arguments.parseArguments(commandLineArguments);
+    if (!CommandLineArgument::getUnprocessedArguments(commandLineArguments).empty() || !arguments.validateArguments()) {
+        std::cerr << "Error parsing command line\n";
+        return 1;
+    }
+    if (arguments.help) {
+        std::cout << "Simulates ULLS doorbell submission between a producer and a consumer polling a ring buffer. Parameters:\n"
+                  << arguments.getHelp(1u);
+        return 0;
+    }
+
+    const uint64_t ringEntries = roundUpToPowerOfTwo(std::max<uint64_t>(arguments.ringEntries, arguments.batchSize));
+    const uint64_t commandsCount = arguments.submissions * arguments.batchSize;
+    const size_t memorySize = RingLayout::getRequiredSize(ringEntries, commandsCount);
+
+    // Memory has to be shared with the forked consumer in cross process mode
+    std::unique_ptr<std::byte, std::function<void(std::byte *)>> memory{};
+#if defined(__linux__)
+    if (arguments.crossProcess) {
+        void *mapping = mmap(nullptr, memorySize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+        FATAL_ERROR_IF(mapping == MAP_FAILED, "Allocating shared memory failed");
+        memory = decltype(memory){static_cast<std::byte *>(mapping), [memorySize](std::byte *pointer) { munmap(pointer, memorySize); }};
+    }
+#endif
+    if (!memory) {
+        memory = decltype(memory){new std::byte[memorySize + cacheLineSize], [](std::byte *pointer) { delete[] pointer; }};
+    }
+    std::byte *alignedMemory = memory.get() + (cacheLineSize - reinterpret_cast<uintptr_t>(memory.get()) % cacheLineSize) % cacheLineSize;
+    std::memset(alignedMemory, 0, memorySize);
+    const RingLayout ring = RingLayout::create(alignedMemory, ringEntries, arguments.separateCacheLines);
+
+    const auto start = Clock::now();
+#if defined(__linux__)
+    if (arguments.crossProcess) {
+        runCrossProcess(ring, arguments);
+    }
+#endif
+    if (!arguments.crossProcess) {
+        std::thread consumer(runConsumer, ring, std::cref(arguments));
+        runProducer(ring, arguments);
+        consumer.join();
+    }
+    const auto end = Clock::now();
+
+    std::vector<int64_t> latencies(ring.latenciesNs, ring.latenciesNs + commandsCount);
+    std::sort(latencies.begin(), latencies.end());
+    const auto percentile = [&latencies](double value) { return latencies[static_cast<size_t>(value / 100 * (latencies.size() - 1))]; };
+    const double commandsPerUs = commandsCount / std::chrono::duration<double, std::micro>(end - start).count();
+
+    std::cout << "Submission latency [ns]: p50=" << percentile(50)
+              << " p90=" << percentile(90)
+              << " p99=" << percentile(99)
+              << " p99.9=" << percentile(99.9)
+              << " max=" << latencies.back()
+              << ", throughput: " << std::fixed << std::setprecision(3) << commandsPerUs << " commands/us\n";
+    return 0;
+}
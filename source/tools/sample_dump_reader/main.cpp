@@ -0,0 +1,288 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/argument/argument_container.h"
+#include "framework/argument/basic_argument.h"
+#include "framework/argument/boolean_flag_argument.h"
+#include "framework/argument/string_argument.h"
+#include "framework/utility/mapped_file.h"
+#include "framework/utility/sample_dump_format.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Reads files written by benchmarks run with --dumpSamples. Besides basic statistics of each channel it shows how
+// the mean changes over the duration of the test, which exposes thermal throttling and other slow drifts, and finds
+// the strongest periodic pattern in the samples, which exposes jitter caused by e.g. timer interrupts or background
+// services. Files are memory-mapped, so dumps of long runs can be processed without loading them first.
+
+struct SampleDumpReaderArguments : ArgumentContainer {
+    BooleanFlagArgument help;
+    StringArgument file;
+    PositiveIntegerArgument windows;
+    PositiveIntegerArgument maxPeriod;
+    BooleanFlagArgument csv;
+
+    SampleDumpReaderArguments()
+        : help(*this, "help", "Shows this message"),
+          file(*this, "file", "Sample dump file written by a benchmark run with --dumpSamples"),
+          windows(*this, "windows", "Number of equal time windows the test is divided into to show the trend of mean values"),
+          maxPeriod(*this, "maxPeriod", "Longest period in samples looked for when searching for periodic jitter"),
+          csv(*this, "csv", "Print all samples as CSV instead of the analysis") {
+        help = false;
+        file = "";
+        windows = 10;
+        maxPeriod = 64;
+        csv = false;
+    }
+};
+
+class SampleDumpView {
+  public:
+    struct Channel {
+        const char *label;
+        const char *type;
+    };
+
+    explicit SampleDumpView(const MappedFile &file) {
+        if (!file.isValid() || file.getSize() < sizeof(SampleDumpHeader)) {
+            error = "file is empty or could not be mapped";
+            return;
+        }
+        header = reinterpret_cast<const SampleDumpHeader *>(file.getData());
+        if (std::memcmp(header->magic, SampleDumpHeader::expectedMagic, sizeof(header->magic)) != 0) {
+            error = "not a sample dump";
+            return;
+        }
+        if (header->version != SampleDumpHeader::currentVersion) {
+            error = "unsupported version " + std::to_string(header->version);
+            return;
+        }
+
+        const uint64_t count = header->sampleCount;
+        const bool arraysFit = header->timestampsOffset + count * sizeof(uint64_t) <= file.getSize() &&
+                               header->valuesOffset + count * sizeof(double) <= file.getSize() &&
+                               header->channelIdsOffset + count * sizeof(uint32_t) <= file.getSize() &&
+                               header->stringsOffset + header->stringsSize <= file.getSize();
+        if (!arraysFit) {
+            error = "file is truncated";
+            return;
+        }
+        timestamps = reinterpret_cast<const uint64_t *>(file.getData() + header->timestampsOffset);
+        values = reinterpret_cast<const double *>(file.getData() + header->valuesOffset);
+        channelIds = reinterpret_cast<const uint32_t *>(file.getData() + header->channelIdsOffset);
+
+        // Strings are null-terminated one after another: test name, then label and type of each channel
+        const char *strings = reinterpret_cast<const char *>(file.getData() + header->stringsOffset);
+        const char *stringsEnd = strings + header->stringsSize;
+        const auto nextString = [&]() -> const char * {
+            const char *terminator = std::find(strings, stringsEnd, '\0');
+            if (terminator == stringsEnd) {
+                return nullptr;
+            }
+            const char *result = strings;
+            strings = terminator + 1;
+            return result;
+        };
+        testCaseName = nextString();
+        if (testCaseName == nullptr) {
+            error = "corrupted test name";
+            return;
+        }
+        for (auto channelIndex = 0u; channelIndex < header->channelCount; channelIndex++) {
+            const char *label = nextString();
+            const char *type = nextString();
+            if (label == nullptr || type == nullptr) {
+                error = "corrupted channel names";
+                return;
+            }
+            channels.push_back({label, type});
+        }
+        for (uint64_t sampleIndex = 0; sampleIndex < count; sampleIndex++) {
+            if (channelIds[sampleIndex] >= channels.size()) {
+                error = "invalid channel id";
+                return;
+            }
+        }
+    }
+
+    const std::string &getError() const { return error; }
+    const SampleDumpHeader &getHeader() const { return *header; }
+    uint64_t getSampleCount() const { return header->sampleCount; }
+    const char *getTestCaseName() const { return testCaseName; }
+    const std::vector<Channel> &getChannels() const { return channels; }
+    uint64_t getTimestamp(uint64_t sampleIndex) const { return timestamps[sampleIndex]; }
+    double getValue(uint64_t sampleIndex) const { return values[sampleIndex]; }
+    uint32_t getChannelId(uint64_t sampleIndex) const { return channelIds[sampleIndex]; }
+
+  private:
+    std::string error = {};
+    const SampleDumpHeader *header = nullptr;
+    const uint64_t *timestamps = nullptr;
+    const double *values = nullptr;
+    const uint32_t *channelIds = nullptr;
+    const char *testCaseName = nullptr;
+    std::vector<Channel> channels = {};
+};
+
+struct ChannelSamples {
+    std::vector<uint64_t> timestamps = {};
+    std::vector<double> values = {};
+};
+
+std::vector<ChannelSamples> splitByChannel(const SampleDumpView &dump) {
+    std::vector<ChannelSamples> result(dump.getChannels().size());
+    for (uint64_t sampleIndex = 0; sampleIndex < dump.getSampleCount(); sampleIndex++) {
+        auto &channel = result[dump.getChannelId(sampleIndex)];
+        channel.timestamps.push_back(dump.getTimestamp(sampleIndex));
+        channel.values.push_back(dump.getValue(sampleIndex));
+    }
+    return result;
+}
+
+double calculateMean(const double *begin, const double *end) {
+    if (begin == end) {
+        return 0;
+    }
+    double sum = 0;
+    for (auto it = begin; it != end; it++) {
+        sum += *it;
+    }
+    return sum / (end - begin);
+}
+
+// Returns the lag with the highest autocorrelation and its value. Strong autocorrelation at some lag means
+// that the samples repeat a pattern every lag samples.
+std::pair<size_t, double> findStrongestPeriod(const std::vector<double> &values, size_t maxPeriod) {
+    const double mean = calculateMean(values.data(), values.data() + values.size());
+    double variance = 0;
+    for (double value : values) {
+        variance += (value - mean) * (value - mean);
+    }
+
+    std::pair<size_t, double> best{0, 0};
+    if (variance == 0) {
+        return best;
+    }
+    maxPeriod = std::min(maxPeriod, values.size() / 2);
+    for (size_t lag = 2; lag <= maxPeriod; lag++) {
+        double covariance = 0;
+        for (size_t index = lag; index < values.size(); index++) {
+            covariance += (values[index] - mean) * (values[index - lag] - mean);
+        }
+        const double autocorrelation = covariance / variance;
+        if (autocorrelation > best.second) {
+            best = {lag, autocorrelation};
+        }
+    }
+    return best;
+}
+
+void printCsv(const SampleDumpView &dump) {
+    std::cout << "timestamp [ns],channel,value\n";
+    for (uint64_t sampleIndex = 0; sampleIndex < dump.getSampleCount(); sampleIndex++) {
+        const auto &channel = dump.getChannels()[dump.getChannelId(sampleIndex)];
+        std::cout << dump.getTimestamp(sampleIndex) << ',' << channel.label << ',' << std::setprecision(17) << dump.getValue(sampleIndex) << '\n';
+    }
+}
+
+void printAnalysis(const SampleDumpView &dump, size_t windowsCount, size_t maxPeriod) {
+    const uint64_t testDuration = dump.getSampleCount() > 0 ? dump.getTimestamp(dump.getSampleCount() - 1) : 0;
+    std::cout << "Test:     " << dump.getTestCaseName() << '\n'
+              << "Samples:  " << dump.getSampleCount() << " in " << dump.getChannels().size() << " channels over " << std::fixed << std::setprecision(3) << testDuration / 1e9 << " s\n";
+
+    const int width = 18;
+    const auto channels = splitByChannel(dump);
+    for (auto channelIndex = 0u; channelIndex < channels.size(); channelIndex++) {
+        const auto &channel = dump.getChannels()[channelIndex];
+        const auto &samples = channels[channelIndex];
+        if (samples.values.empty()) {
+            continue;
+        }
+
+        std::vector<double> sorted = samples.values;
+        std::sort(sorted.begin(), sorted.end());
+        const double *begin = samples.values.data();
+        const double *end = begin + samples.values.size();
+        std::cout << std::setprecision(3) << "\nChannel " << channelIndex << ": " << channel.type << ' ' << channel.label << '\n'
+                  << std::setw(width) << "Mean" << std::setw(width) << "Median" << std::setw(width) << "Min" << std::setw(width) << "Max" << '\n'
+                  << std::setw(width) << calculateMean(begin, end) << std::setw(width) << sorted[sorted.size() / 2]
+                  << std::setw(width) << sorted.front() << std::setw(width) << sorted.back() << '\n';
+
+        // Samples are assigned to windows by timestamp, so a throttled part of the test shows up in the window it happened
+        std::cout << "  Mean over time:\n"
+                  << std::setw(width) << "Window start [s]" << std::setw(width) << "Samples" << std::setw(width) << "Mean" << std::setw(width) << "vs first" << '\n';
+        const double windowDuration = std::max<double>(1.0, static_cast<double>(testDuration) / windowsCount);
+        double firstWindowMean = 0;
+        size_t windowBegin = 0;
+        for (size_t windowIndex = 0; windowIndex < windowsCount && windowBegin < samples.values.size(); windowIndex++) {
+            const double windowEndTime = windowIndex + 1 == windowsCount ? INFINITY : (windowIndex + 1) * windowDuration;
+            size_t windowEnd = windowBegin;
+            while (windowEnd < samples.values.size() && samples.timestamps[windowEnd] < windowEndTime) {
+                windowEnd++;
+            }
+            if (windowEnd == windowBegin) {
+                continue;
+            }
+
+            const double mean = calculateMean(begin + windowBegin, begin + windowEnd);
+            if (firstWindowMean == 0) {
+                firstWindowMean = mean;
+            }
+            std::cout << std::setw(width) << windowIndex * windowDuration / 1e9 << std::setw(width) << windowEnd - windowBegin << std::setw(width) << mean
+                      << std::setw(width - 1) << (firstWindowMean != 0 ? 100 * (mean - firstWindowMean) / firstWindowMean : 0) << "%\n";
+            windowBegin = windowEnd;
+        }
+
+        const auto [period, autocorrelation] = findStrongestPeriod(samples.values, maxPeriod);
+        if (period == 0) {
+            std::cout << "  No periodic pattern found\n";
+        } else {
+            std::cout << "  Strongest periodic pattern: every " << period << " samples, autocorrelation " << std::setprecision(2) << autocorrelation << '\n';
+        }
+    }
+}
+
+int main(int argc, char **argv) {
+    CommandLineArguments commandLineArguments{};
+    std::string errorMessage{};
+    if (!CommandLineArgument::parseArguments(argc, argv, commandLineArguments, errorMessage)) {
+        std::cerr << errorMessage << std::endl;
+        return 1;
+    }
+
+    SampleDumpReaderArguments arguments{};
+    arguments.parseArguments(commandLineArguments);
+    if (!CommandLineArgument::getUnprocessedArguments(commandLineArguments).empty() || !arguments.validateArguments()) {
+        std::cerr << "Error parsing command line\n";
+        return 1;
+    }
+    if (arguments.help || static_cast<const std::string &>(arguments.file).empty()) {
+        std::cout << "Analyzes samples dumped by benchmarks run with --dumpSamples. Parameters:\n"
+                  << arguments.getHelp(1u);
+        return arguments.help ? 0 : 1;
+    }
+
+    const MappedFile file{arguments.file};
+    const SampleDumpView dump{file};
+    if (!dump.getError().empty()) {
+        std::cerr << "Could not read " << static_cast<const std::string &>(arguments.file) << ": " << dump.getError() << '\n';
+        return 1;
+    }
+
+    if (arguments.csv) {
+        printCsv(dump);
+    } else {
+        printAnalysis(dump, arguments.windows, arguments.maxPeriod);
+    }
+    return 0;
+}
@@ -0,0 +1,218 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/argument/argument_container.h"
+#include "framework/argument/basic_argument.h"
+#include "framework/argument/boolean_flag_argument.h"
+#include "framework/argument/enum/wait_strategy_argument.h"
+#include "framework/utility/cpu_topology_helper.h"
+#include "framework/utility/wait_helper.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+#if defined(_WIN32)
+#include "framework/utility/windows/windows.h"
+#else
+#include <ctime>
+#endif
+
+// Compares WaitHelper strategies between two host threads. The waker thread writes a flag after a delay and the
+// waiter thread waits for it using the selected strategy. Reported are the wake-up latency (time between the write
+// and the waiter noticing it), the share of wall time the waiter spent on the CPU and, if a CPU is given with
+// --siblingCpu, the throughput of a compute thread running there (typically hyperthread sibling of the waiter).
+
+struct WaitStrategyComparisonArguments : ArgumentContainer {
+    BooleanFlagArgument help;
+    PositiveIntegerArgument iterations;
+    NonNegativeIntegerArgument wakeDelayUs;
+    NonNegativeIntegerArgument waiterCpu;
+    NonNegativeIntegerArgument wakerCpu;
+    IntegerArgument siblingCpu;
+
+    WaitStrategyComparisonArguments()
+        : help(*this, "help", "Shows this message"),
+          iterations(*this, "iterations", "Number of wake-ups measured for each strategy"),
+          wakeDelayUs(*this, "wakeDelayUs", "Time the waker thread waits before writing the flag"),
+          waiterCpu(*this, "waiterCpu", "CPU the waiting thread is pinned to"),
+          wakerCpu(*this, "wakerCpu", "CPU the waking thread is pinned to"),
+          siblingCpu(*this, "siblingCpu", "CPU running a compute thread to measure interference of the waiter. -1 to disable") {
+        help = false;
+        iterations = 1000;
+        wakeDelayUs = 20;
+        waiterCpu = 0;
+        wakerCpu = 1;
+        siblingCpu = -1;
+    }
+};
+
+using Clock = std::chrono::steady_clock;
+
+static Clock::duration getThreadCpuTime() {
+#if defined(_WIN32)
+    FILETIME creationTime{}, exitTime{}, kernelTime{}, userTime{};
+    GetThreadTimes(GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime);
+    const auto toTicks = [](const FILETIME &time) { return (static_cast<uint64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime; };
+    const std::chrono::duration<uint64_t, std::ratio<1, 10000000>> total{toTicks(kernelTime) + toTicks(userTime)};
+    return std::chrono::duration_cast<Clock::duration>(total);
+#else
+    timespec time{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+    return std::chrono::duration_cast<Clock::duration>(std::chrono::seconds(time.tv_sec) + std::chrono::nanoseconds(time.tv_nsec));
+#endif
+}
+
+static void busyWait(std::chrono::microseconds delay) {
+    const auto end = Clock::now() + delay;
+    while (Clock::now() < end) {
+    }
+}
+
+class SiblingWorkload {
+  public:
+    explicit SiblingWorkload(int64_t cpu) {
+        if (cpu < 0) {
+            return;
+        }
+        thread = std::thread([this, cpu]() {
+            CpuTopologyHelper::pinCurrentThread(static_cast<size_t>(cpu));
+            volatile uint64_t value = 1;
+            while (!stop.load(std::memory_order_relaxed)) {
+                for (int i = 0; i < 1000; i++) {
+                    value = value * 6364136223846793005ull + 1442695040888963407ull;
+                }
+                operations.fetch_add(1000, std::memory_order_relaxed);
+            }
+        });
+    }
+
+    ~SiblingWorkload() {
+        if (thread.joinable()) {
+            stop = true;
+            thread.join();
+        }
+    }
+
+    bool isEnabled() const { return thread.joinable(); }
+    uint64_t getOperations() const { return operations.load(); }
+
+  private:
+    std::thread thread{};
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> operations{0};
+};
+
+struct Results {
+    std::vector<int64_t> latenciesNs;
+    double waiterCpuUsage;
+    double siblingMops;
+};
+
+static Results measure(WaitStrategy strategy, const WaitStrategyComparisonArguments &arguments) {
+    alignas(64) volatile uint64_t flag = 0;
+    alignas(64) std::atomic<uint64_t> acknowledged{0};
+    alignas(64) std::atomic<int64_t> writeTimestampNs{0};
+    const uint64_t iterations = arguments.iterations;
+    const auto wakeDelay = std::chrono::microseconds(static_cast<size_t>(arguments.wakeDelayUs));
+
+    Results results{};
+    results.latenciesNs.reserve(iterations);
+
+    SiblingWorkload sibling{arguments.siblingCpu};
+    const uint64_t siblingOperationsStart = sibling.getOperations();
+    const auto wallStart = Clock::now();
+
+    std::thread waker([&]() {
+        CpuTopologyHelper::pinCurrentThread(arguments.wakerCpu);
+        for (uint64_t i = 1; i <= iterations; i++) {
+            busyWait(wakeDelay);
+            writeTimestampNs.store(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count(), std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            flag = i;
+            if (strategy == WaitStrategy::FutexSleep) {
+                WaitHelper::notify(&flag);
+            }
+            while (acknowledged.load(std::memory_order_acquire) != i) {
+                _mm_pause();
+            }
+        }
+    });
+
+    CpuTopologyHelper::pinCurrentThread(arguments.waiterCpu);
+    const auto cpuTimeStart = getThreadCpuTime();
+    for (uint64_t i = 1; i <= iterations; i++) {
+        WaitHelper::waitWhileEqual(&flag, i - 1, strategy);
+        const int64_t wakeTimestampNs = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+        std::atomic_thread_fence(std::memory_order_acquire);
+        results.latenciesNs.push_back(wakeTimestampNs - writeTimestampNs.load(std::memory_order_relaxed));
+        acknowledged.store(i, std::memory_order_release);
+    }
+    const auto cpuTime = getThreadCpuTime() - cpuTimeStart;
+    waker.join();
+
+    const auto wallTime = Clock::now() - wallStart;
+    results.waiterCpuUsage = std::chrono::duration<double>(cpuTime).count() / std::chrono::duration<double>(wallTime).count();
+    results.siblingMops = (sibling.getOperations() - siblingOperationsStart) / std::chrono::duration<double, std::micro>(wallTime).count();
+    return results;
+}
+
+int main(int argc, char **argv) {
+    CommandLineArguments commandLineArguments{};
+    std::string errorMessage{};
+    if (!CommandLineArgument::parseArguments(argc, argv, commandLineArguments, errorMessage)) {
+        std::cerr << errorMessage << std::endl;
+        return 1;
+    }
+
+    WaitStrategyComparisonArguments arguments{};
+    arguments.parseArguments(commandLineArguments);
+    if (!CommandLineArgument::getUnprocessedArguments(commandLineArguments).empty() || !arguments.validateArguments()) {
+        std::cerr << "Error parsing command line\n";
+        return 1;
+    }
+    if (arguments.help) {
+        std::cout << "Measures wake-up latency and CPU cost of host wait strategies. Parameters:\n"
+                  << arguments.getHelp(1u);
+        return 0;
+    }
+
+    std::cout << std::setw(12) << "Strategy"
+              << std::setw(12) << "p50[ns]"
+              << std::setw(12) << "p99[ns]"
+              << std::setw(12) << "max[ns]"
+              << std::setw(12) << "WaiterCPU"
+              << std::setw(16) << "Sibling[Mop/s]" << '\n';
+
+    constexpr size_t strategiesCount = sizeof(WaitStrategyArgument::enumValues) / sizeof(WaitStrategyArgument::enumValues[0]);
+    for (size_t strategyIndex = 0; strategyIndex < strategiesCount; strategyIndex++) {
+        const WaitStrategy strategy = WaitStrategyArgument::enumValues[strategyIndex];
+        const std::string &strategyName = WaitStrategyArgument::enumValuesNames[strategyIndex];
+        if (!WaitHelper::isStrategySupported(strategy)) {
+            std::cout << std::setw(12) << strategyName << "  not supported by this CPU\n";
+            continue;
+        }
+
+        Results results = measure(strategy, arguments);
+        std::sort(results.latenciesNs.begin(), results.latenciesNs.end());
+        const auto percentile = [&results](double value) { return results.latenciesNs[static_cast<size_t>(value / 100 * (results.latenciesNs.size() - 1))]; };
+
+        std::cout << std::setw(12) << strategyName
+                  << std::setw(12) << percentile(50)
+                  << std::setw(12) << percentile(99)
+                  << std::setw(12) << results.latenciesNs.back()
+                  << std::setw(11) << std::fixed << std::setprecision(1) << results.waiterCpuUsage * 100 << '%';
+        if (arguments.siblingCpu >= 0) {
+            std::cout << std::setw(16) << std::setprecision(2) << results.siblingMops;
+        }
+        std::cout << '\n';
+    }
+    return 0;
+}
@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/test_case/ab_comparison.h"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(AbComparisonTest, givenPairedBatchMeansThenDifferenceAndConfidenceIntervalMatchHandComputedValues) {
+    // Paired differences are 1, 2 and 1, so their mean is 4/3 and their standard deviation is sqrt(1/3). Standard error
+    // is sqrt(1/3 / 3) = 1/3 and the interval is t(2) = 4.303 times that, relative to mean of A equal to 12.
+    const auto result = AbComparison::compare(MeasurementUnit::Microseconds, {10, 12, 14}, {11, 14, 15});
+    EXPECT_EQ(MeasurementUnit::Microseconds, result.unit);
+    EXPECT_DOUBLE_EQ(12.0, result.meanA);
+    EXPECT_DOUBLE_EQ(40.0 / 3, result.meanB);
+    EXPECT_DOUBLE_EQ(1.0 / 9, result.relativeDifference);
+    EXPECT_DOUBLE_EQ(4.303 / 3 / 12, result.confidenceInterval);
+}
+
+TEST(AbComparisonTest, givenConstantDifferenceBetweenBuildsThenConfidenceIntervalIsZero) {
+    // Drift shared by both builds is removed by pairing, only the difference within each pair counts
+    const auto result = AbComparison::compare(MeasurementUnit::Microseconds, {10, 20, 30, 40}, {9, 19, 29, 39});
+    EXPECT_DOUBLE_EQ(-1.0 / 25, result.relativeDifference);
+    EXPECT_DOUBLE_EQ(0.0, result.confidenceInterval);
+}
+
+TEST(AbComparisonTest, givenBatchMeansOfDifferentCountsThenOnlyPairsAreCompared) {
+    const auto result = AbComparison::compare(MeasurementUnit::GigabytesPerSecond, {10, 12, 100}, {11, 13});
+    EXPECT_DOUBLE_EQ(11.0, result.meanA);
+    EXPECT_DOUBLE_EQ(12.0, result.meanB);
+    EXPECT_DOUBLE_EQ(0.0, result.confidenceInterval);
+}
+
+TEST(AbComparisonTest, givenSinglePairThenConfidenceIntervalIsUnknown) {
+    const auto result = AbComparison::compare(MeasurementUnit::Microseconds, {10}, {12});
+    EXPECT_DOUBLE_EQ(0.2, result.relativeDifference);
+    EXPECT_TRUE(std::isinf(result.confidenceInterval));
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "tools/api_call_tracer/call_statistics.h"
+
+#include <chrono>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using Histogram = CallStatistics::Histogram;
+using namespace std::chrono_literals;
+
+// Rows of the summary by the name of the test they are printed for, each row split into its columns
+static std::map<std::string, std::vector<std::vector<std::string>>> getSummaryRows(CallStatistics &statistics) {
+    std::ostringstream summary{};
+    statistics.printSummary(summary);
+
+    std::map<std::string, std::vector<std::vector<std::string>>> rows{};
+    std::istringstream lines{summary.str()};
+    std::string testName{};
+    for (std::string line{}; std::getline(lines, line);) {
+        if (line.empty()) {
+            continue;
+        }
+        if (line[0] != ' ') {
+            testName = line;
+            continue;
+        }
+        std::istringstream columns{line};
+        std::vector<std::string> row{};
+        for (std::string column{}; columns >> column;) {
+            row.push_back(column);
+        }
+        if (row[0] != "Function") {
+            rows[testName].push_back(row);
+        }
+    }
+    return rows;
+}
+
+TEST(CallStatisticsTest, givenSmallValuesThenEachHasItsOwnBucket) {
+    for (uint64_t value = 0; value < Histogram::subBucketsCount; value++) {
+        EXPECT_EQ(value, Histogram::getBucketUpperBound(Histogram::getBucketIndex(value)));
+    }
+}
+
+TEST(CallStatisticsTest, givenLargeValuesThenBucketUpperBoundIsWithinRelativeError) {
+    const uint64_t values[] = {8, 9, 15, 16, 100, 1000, 1024, 1025, 123456789, uint64_t{1} << 40, std::numeric_limits<uint64_t>::max()};
+    for (const uint64_t value : values) {
+        const size_t bucketIndex = Histogram::getBucketIndex(value);
+        ASSERT_LT(bucketIndex, Histogram::bucketsCount) << value;
+        const uint64_t upperBound = Histogram::getBucketUpperBound(bucketIndex);
+        EXPECT_GE(upperBound, value);
+        EXPECT_LE(static_cast<double>(upperBound), static_cast<double>(value) * 1.125) << value;
+    }
+    EXPECT_EQ(std::numeric_limits<uint64_t>::max(), Histogram::getBucketUpperBound(Histogram::bucketsCount - 1));
+}
+
+TEST(CallStatisticsTest, givenSamplesThenPercentilesAreUpperBoundsOfTheirBuckets) {
+    Histogram histogram{};
+    EXPECT_EQ(0u, histogram.getPercentile(0.5));
+
+    // 100 falls into bucket [96, 103], 1000000 into [983040, 1048575]
+    for (int sample = 0; sample < 99; sample++) {
+        histogram.add(100);
+    }
+    histogram.add(1000000);
+    EXPECT_EQ(100u, histogram.count);
+    EXPECT_EQ(103u, histogram.getPercentile(0.5));
+    EXPECT_EQ(103u, histogram.getPercentile(0.99));
+    EXPECT_EQ(1048575u, histogram.getPercentile(1.0));
+}
+
+TEST(CallStatisticsTest, givenCallsInTestsThenTheyAreSummarizedForEachTest) {
+    CallStatistics statistics{};
+    statistics.recordCall("zeInit", 1000ns);
+    statistics.beginTest("A(api=l0)");
+    statistics.recordCall("zeCommandListAppendLaunchKernel", 100ns);
+    statistics.recordCall("zeCommandListAppendLaunchKernel", 300ns);
+    statistics.endTest();
+    statistics.recordCall("zeInit", 3000ns);
+    statistics.beginTest("B(api=l0)");
+    statistics.recordCall("zeCommandQueueSynchronize", 5000ns);
+    statistics.endTest();
+
+    // Test run again, e.g. in another round, adds to its previous calls
+    statistics.beginTest("A(api=l0)");
+    statistics.recordCall("zeCommandListAppendLaunchKernel", 200ns);
+    statistics.endTest();
+
+    const auto rows = getSummaryRows(statistics);
+    ASSERT_EQ(3u, rows.size());
+    // Columns are function, calls, total [us], mean, p50, p99 and max [ns]. Percentiles do not exceed the maximum.
+    EXPECT_EQ((std::vector<std::vector<std::string>>{{"zeInit", "2", "4", "2000", "1023", "3000", "3000"}}), rows.at("(outside of tests)"));
+    EXPECT_EQ((std::vector<std::vector<std::string>>{{"zeCommandListAppendLaunchKernel", "3", "0", "200", "207", "300", "300"}}), rows.at("A(api=l0)"));
+    EXPECT_EQ((std::vector<std::vector<std::string>>{{"zeCommandQueueSynchronize", "1", "5", "5000", "5000", "5000", "5000"}}), rows.at("B(api=l0)"));
+}
+
+TEST(CallStatisticsTest, givenSummaryPrintedThenLaterCallsAreNotRecorded) {
+    CallStatistics statistics{};
+    statistics.beginTest("A(api=l0)");
+    statistics.recordCall("clFinish", 100ns);
+    std::ostringstream summary{};
+    statistics.printSummary(summary);
+
+    statistics.recordCall("clFinish", 100ns);
+    const auto rows = getSummaryRows(statistics);
+    ASSERT_EQ(1u, rows.size());
+    EXPECT_EQ("1", rows.at("A(api=l0)")[0][1]);
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/clock_correlator.h"
+
+#include <cstdint>
+#include <gtest/gtest.h>
+
+// Device clock which runs at a given resolution with a drift relative to the host clock and a fixed offset between them
+struct SyntheticClock {
+    uint64_t offsetNanoseconds;
+    double nanosecondsPerTick;
+
+    uint64_t getHostNanoseconds(uint64_t deviceTicks) const {
+        return offsetNanoseconds + static_cast<uint64_t>(static_cast<double>(deviceTicks) * nanosecondsPerTick + 0.5);
+    }
+};
+
+TEST(ClockCorrelatorTest, givenOffsetAndDriftWhenSamplesAreAddedThenBothAreRecovered) {
+    const double resolution = 10.0;
+    const SyntheticClock clock{123456789, resolution * (1 + 50e-6)};
+    ClockCorrelator correlator{64, resolution};
+
+    // Host timestamps are taken with a jitter of a few nanoseconds, as with real APIs
+    for (uint64_t sampleIndex = 0; sampleIndex < 16; sampleIndex++) {
+        const uint64_t deviceTicks = 1000 + sampleIndex * 1000000;
+        const uint64_t jitter = sampleIndex % 2 == 0 ? 3 : 0;
+        correlator.addSample({clock.getHostNanoseconds(deviceTicks) + jitter, deviceTicks});
+    }
+
+    EXPECT_NEAR(50.0, correlator.getDriftPartsPerMillion(), 0.1);
+    const uint64_t deviceTicks = 20000000;
+    EXPECT_NEAR(static_cast<double>(clock.getHostNanoseconds(deviceTicks)), static_cast<double>(correlator.toHostNanoseconds(deviceTicks)), 5.0);
+}
+
+TEST(ClockCorrelatorTest, givenSingleSampleThenNominalResolutionIsUsed) {
+    ClockCorrelator correlator{64, 2.0};
+    correlator.addSample({5000, 100});
+
+    EXPECT_DOUBLE_EQ(0.0, correlator.getDriftPartsPerMillion());
+    EXPECT_EQ(5200u, correlator.toHostNanoseconds(200));
+}
+
+TEST(ClockCorrelatorTest, givenMoreSamplesThanLimitThenOnlyRecentOnesAreKept) {
+    ClockCorrelator correlator{64, 1.0, 4};
+    for (uint64_t sampleIndex = 0; sampleIndex < 10; sampleIndex++) {
+        correlator.addSample({sampleIndex * 1000, sampleIndex * 1000});
+    }
+    EXPECT_EQ(4u, correlator.getSamplesCount());
+}
+
+TEST(ClockCorrelatorTest, givenDeviceTimestampsWrappingAroundValidBitsWhenSamplesAreAddedThenTimelineIsContinuous) {
+    const uint32_t validBits = 20;
+    const uint64_t period = 1ull << validBits;
+    const uint64_t mask = period - 1;
+    const SyntheticClock clock{1000000000, 1.0};
+    ClockCorrelator correlator{validBits, 1.0};
+
+    // Samples cross the wraparound, the correlator only sees the lower bits of the device counter
+    for (uint64_t sampleIndex = 0; sampleIndex < 8; sampleIndex++) {
+        const uint64_t deviceTicks = period - 500000 + sampleIndex * 100000;
+        correlator.addSample({clock.getHostNanoseconds(deviceTicks), deviceTicks & mask});
+    }
+    EXPECT_NEAR(0.0, correlator.getDriftPartsPerMillion(), 1.0);
+
+    // Timestamps from before and after the wrap are converted relative to the most recent sample
+    const uint64_t beforeWrap = period - 100;
+    const uint64_t afterWrap = period + 350000;
+    EXPECT_NEAR(static_cast<double>(clock.getHostNanoseconds(beforeWrap)), static_cast<double>(correlator.toHostNanoseconds(beforeWrap & mask)), 1.0);
+    EXPECT_NEAR(static_cast<double>(clock.getHostNanoseconds(afterWrap)), static_cast<double>(correlator.toHostNanoseconds(afterWrap & mask)), 1.0);
+}
+
+TEST(ClockCorrelatorTest, givenTimestampWithFewerValidBitsThenItIsUnwrappedWithItsOwnMask) {
+    const SyntheticClock clock{0, 1.0};
+    ClockCorrelator correlator{32, 1.0};
+    const uint64_t deviceTicks = (5ull << 16) + 1000;
+    correlator.addSample({clock.getHostNanoseconds(deviceTicks), deviceTicks});
+
+    // Kernel timestamps with 16 valid bits, taken shortly after the sample
+    const uint64_t kernelTicks = deviceTicks + 200;
+    EXPECT_EQ(clock.getHostNanoseconds(kernelTicks), correlator.toHostNanoseconds(kernelTicks & 0xFFFF, 16));
+}
+
+TEST(ClockCorrelatorTest, givenTruncatedTimestampThenUnwrapPicksClosestValueToReference) {
+    const uint32_t validBits = 8;
+    EXPECT_EQ(0x105u, ClockCorrelator::unwrap(0x05, 0xF0, validBits));
+    EXPECT_EQ(0x1F0u, ClockCorrelator::unwrap(0xF0, 0x205, validBits));
+    EXPECT_EQ(0x210u, ClockCorrelator::unwrap(0x10, 0x205, validBits));
+    EXPECT_EQ(0xF0u, ClockCorrelator::unwrap(0xF0, 0x05, validBits));
+    EXPECT_EQ(0x1234u, ClockCorrelator::unwrap(0x1234, 0x99999, 64));
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/test_case/isolated_test_runner.h"
+
+#include <gtest/gtest.h>
+#include <limits>
+#include <string>
+#include <vector>
+
+using SampleGroups = IsolatedTestRunner::SampleGroups;
+
+static void expectEqualGroups(const SampleGroups &expected, const SampleGroups &actual) {
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t groupIndex = 0; groupIndex < expected.size(); groupIndex++) {
+        EXPECT_EQ(expected[groupIndex].description, actual[groupIndex].description);
+        EXPECT_EQ(expected[groupIndex].unit, actual[groupIndex].unit);
+        EXPECT_EQ(expected[groupIndex].samples, actual[groupIndex].samples);
+    }
+}
+
+TEST(IsolatedTestRunnerTest, givenMultipleGroupsThenSamplesAreParsedExactlyAsFormatted) {
+    const SampleGroups groups = {
+        {"", MeasurementUnit::Microseconds, {1.5, 0.1, 1e-9, std::numeric_limits<double>::max()}},
+        {"bw", MeasurementUnit::GigabytesPerSecond, {123.456789012345}},
+        {"process cpu time [us]", MeasurementUnit::Custom, {3, 4, 5}},
+    };
+
+    SampleGroups parsed{};
+    ASSERT_TRUE(IsolatedTestRunner::parseSamples(IsolatedTestRunner::formatSamples(groups), parsed));
+    expectEqualGroups(groups, parsed);
+}
+
+TEST(IsolatedTestRunnerTest, givenOtherMeasurementsBeforeSamplesThenOnlyLastSamplesAreParsed) {
+    const SampleGroups stale = {{"", MeasurementUnit::Microseconds, {100}}};
+    const SampleGroups groups = {{"", MeasurementUnit::Nanoseconds, {1, 2}}, {"time", MeasurementUnit::Microseconds, {3}}};
+    const std::string measurements = "1 2 3\n" + IsolatedTestRunner::formatSamples(stale) + IsolatedTestRunner::formatSamples(groups);
+
+    SampleGroups parsed{};
+    ASSERT_TRUE(IsolatedTestRunner::parseSamples(measurements, parsed));
+    expectEqualGroups(groups, parsed);
+}
+
+TEST(IsolatedTestRunnerTest, givenGroupWithoutSamplesThenItIsParsedEmpty) {
+    const SampleGroups groups = {{"", MeasurementUnit::Microseconds, {}}, {"bw", MeasurementUnit::GigabytesPerSecond, {7}}};
+
+    SampleGroups parsed{};
+    ASSERT_TRUE(IsolatedTestRunner::parseSamples(IsolatedTestRunner::formatSamples(groups), parsed));
+    expectEqualGroups(groups, parsed);
+}
+
+TEST(IsolatedTestRunnerTest, givenTruncatedOrMissingSamplesThenParsingFails) {
+    const SampleGroups groups = {{"", MeasurementUnit::Microseconds, {1}}, {"bw", MeasurementUnit::GigabytesPerSecond, {2}}};
+    std::string measurements = IsolatedTestRunner::formatSamples(groups);
+    measurements.resize(measurements.rfind("bw") - 2);
+
+    SampleGroups parsed{};
+    EXPECT_FALSE(IsolatedTestRunner::parseSamples(measurements, parsed));
+    EXPECT_FALSE(IsolatedTestRunner::parseSamples("", parsed));
+    EXPECT_FALSE(IsolatedTestRunner::parseSamples(IsolatedTestRunner::formatSamples({}), parsed));
+}
+
+TEST(IsolatedTestRunnerTest, givenGroupsMissingInSomeProcessesThenOnlyCompleteGroupsAreCollected) {
+    IsolatedTestRunner::SampleGroupsCollector collector{2};
+    SampleGroups firstProcess = {{"", MeasurementUnit::Microseconds, {1, 2}}, {"bw", MeasurementUnit::GigabytesPerSecond, {3}}};
+    SampleGroups secondProcess = {{"", MeasurementUnit::Microseconds, {4}}};
+    collector.add(1, secondProcess);
+    collector.add(0, firstProcess);
+
+    std::vector<std::string> names{};
+    collector.forEachCompleteGroup("Test(a=1)", [&](const std::string &name, const IsolatedTestRunner::SampleGroupsCollector::CollectedGroup &group) {
+        names.push_back(name);
+        EXPECT_EQ(MeasurementUnit::Microseconds, group.unit);
+        EXPECT_EQ((std::vector<std::vector<double>>{{1, 2}, {4}}), group.samplesPerProcess);
+    });
+    EXPECT_EQ(std::vector<std::string>{"Test(a=1)"}, names);
+}
+
+TEST(IsolatedTestRunnerTest, givenSignRequestedThenPercentIsFormattedWithIt) {
+    EXPECT_EQ("+1.25%", IsolatedTestRunner::SampleGroupsCollector::formatPercent(0.0125, true));
+    EXPECT_EQ("-3.00%", IsolatedTestRunner::SampleGroupsCollector::formatPercent(-0.03, true));
+    EXPECT_EQ("1.25%", IsolatedTestRunner::SampleGroupsCollector::formatPercent(0.0125, false));
+}
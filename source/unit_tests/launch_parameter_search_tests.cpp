@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/launch_parameter_search.h"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <vector>
+
+using Point = LaunchParameterSearch::Point;
+
+// Smooth bowl in log2 space, like a time per work item which grows for both too small and too large launches
+static double getBowlValue(const Point &point, const Point &optimum) {
+    const double sizeDistance = std::log2(static_cast<double>(point.workgroupSize)) - std::log2(static_cast<double>(optimum.workgroupSize));
+    const double countDistance = std::log2(static_cast<double>(point.workgroupCount)) - std::log2(static_cast<double>(optimum.workgroupCount));
+    return 1 + sizeDistance * sizeDistance + countDistance * countDistance;
+}
+
+TEST(LaunchParameterSearchTest, givenPowersOfTwoRangeThenOnlyValuesWithinItAreReturned) {
+    EXPECT_EQ((std::vector<size_t>{4, 8, 16}), LaunchParameterSearch::getPowersOfTwo(3, 31));
+    EXPECT_EQ((std::vector<size_t>{1}), LaunchParameterSearch::getPowersOfTwo(1, 1));
+}
+
+TEST(LaunchParameterSearchTest, givenSyntheticObjectiveThenOptimumIsFound) {
+    const Point optimum{128, 1024};
+    LaunchParameterSearch search{LaunchParameterSearch::getPowersOfTwo(1, 1024), LaunchParameterSearch::getPowersOfTwo(1, 65536)};
+    search.setMaxEvaluations(200);
+    const auto objective = [&](const Point &point, double &value) {
+        value = getBowlValue(point, optimum);
+        return true;
+    };
+
+    ASSERT_TRUE(search.search({1, 1}, objective));
+    EXPECT_EQ(optimum.workgroupSize, search.getBest().point.workgroupSize);
+    EXPECT_EQ(optimum.workgroupCount, search.getBest().point.workgroupCount);
+    EXPECT_DOUBLE_EQ(1.0, search.getBest().value);
+}
+
+TEST(LaunchParameterSearchTest, givenFailedPointThenPointsWithNotSmallerSizeAndCountAreNotEvaluated) {
+    // Objective improves with larger launches, which fail above a limit of work items, so the search keeps hitting it
+    const size_t maxWorkItems = 4096;
+    LaunchParameterSearch search{LaunchParameterSearch::getPowersOfTwo(1, 1024), LaunchParameterSearch::getPowersOfTwo(1, 1024)};
+    search.setMaxEvaluations(200);
+    std::vector<Point> failedPoints{};
+    const auto objective = [&](const Point &point, double &value) {
+        for (const Point &failed : failedPoints) {
+            EXPECT_FALSE(point.workgroupSize >= failed.workgroupSize && point.workgroupCount >= failed.workgroupCount)
+                << point.workgroupSize << "x" << point.workgroupCount << " is pruned by " << failed.workgroupSize << "x" << failed.workgroupCount;
+        }
+        if (point.workgroupSize * point.workgroupCount > maxWorkItems) {
+            failedPoints.push_back(point);
+            return false;
+        }
+        value = -static_cast<double>(point.workgroupSize * point.workgroupCount);
+        return true;
+    };
+
+    ASSERT_TRUE(search.search({1, 1}, objective));
+    EXPECT_FALSE(failedPoints.empty());
+    EXPECT_EQ(maxWorkItems, search.getBest().point.workgroupSize * search.getBest().point.workgroupCount);
+    for (const auto &evaluation : search.getEvaluations()) {
+        EXPECT_EQ(evaluation.point.workgroupSize * evaluation.point.workgroupCount <= maxWorkItems, evaluation.feasible);
+    }
+}
+
+TEST(LaunchParameterSearchTest, givenEvaluationsLimitThenObjectiveIsNotCalledMoreTimes) {
+    const size_t maxEvaluations = 5;
+    LaunchParameterSearch search{LaunchParameterSearch::getPowersOfTwo(1, 1024), LaunchParameterSearch::getPowersOfTwo(1, 65536)};
+    search.setMaxEvaluations(maxEvaluations);
+    size_t objectiveCalls = 0;
+    const auto objective = [&](const Point &point, double &value) {
+        objectiveCalls++;
+        value = getBowlValue(point, {128, 1024});
+        return true;
+    };
+
+    ASSERT_TRUE(search.search({1, 1}, objective));
+    EXPECT_EQ(maxEvaluations, objectiveCalls);
+    EXPECT_EQ(maxEvaluations, search.getEvaluations().size());
+}
+
+TEST(LaunchParameterSearchTest, givenAllPointsFailingThenNothingIsFound) {
+    LaunchParameterSearch search{LaunchParameterSearch::getPowersOfTwo(1, 64), LaunchParameterSearch::getPowersOfTwo(1, 64)};
+    size_t objectiveCalls = 0;
+    const auto objective = [&](const Point &, double &) {
+        objectiveCalls++;
+        return false;
+    };
+
+    EXPECT_FALSE(search.search({1, 1}, objective));
+    EXPECT_EQ(1u, objectiveCalls);
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/sample_statistics.h"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(SampleStatisticsTest, givenDegreesOfFreedomThenStudentTQuantileMatchesTables) {
+    EXPECT_TRUE(std::isinf(SampleStatistics::getStudentTQuantile(0)));
+    EXPECT_DOUBLE_EQ(12.706, SampleStatistics::getStudentTQuantile(1));
+    EXPECT_DOUBLE_EQ(2.571, SampleStatistics::getStudentTQuantile(5));
+    EXPECT_DOUBLE_EQ(2.042, SampleStatistics::getStudentTQuantile(30));
+
+    // Beyond the table values come from the expansion, t(40) = 2.021, t(120) = 1.980
+    EXPECT_NEAR(2.021, SampleStatistics::getStudentTQuantile(40), 0.002);
+    EXPECT_NEAR(1.980, SampleStatistics::getStudentTQuantile(120), 0.001);
+}
+
+TEST(SampleStatisticsTest, givenGroupsOfEqualSizesThenAnovaMatchesHandComputedValues) {
+    // Group means 2 and 5, grand mean 3.5. Sum of squares between is 3 * 1.5^2 * 2 = 13.5 with 1 degree of freedom,
+    // within is 2 + 2 = 4 with 4 degrees of freedom, so mean squares are 13.5 and 1.
+    const auto anova = SampleStatistics::getOneWayAnova({{1, 2, 3}, {4, 5, 6}});
+    EXPECT_DOUBLE_EQ(3.5, anova.grandMean);
+    EXPECT_EQ(1u, anova.betweenDegreesOfFreedom);
+    EXPECT_EQ(4u, anova.withinDegreesOfFreedom);
+    EXPECT_DOUBLE_EQ(1.0, anova.withinVariance);
+    EXPECT_DOUBLE_EQ((13.5 - 1.0) / 3, anova.betweenVariance);
+    EXPECT_DOUBLE_EQ(13.5, anova.fStatistic);
+}
+
+TEST(SampleStatisticsTest, givenGroupsOfUnequalSizesThenEffectiveGroupSizeIsUsed) {
+    // Group means 2 and 4, grand mean 3.2. Sum of squares between is 2 * 1.2^2 + 3 * 0.8^2 = 4.8 with 1 degree of freedom,
+    // within is 2 + 8 = 10 with 3 degrees of freedom. Effective group size is (5 - (4 + 9) / 5) / 1 = 2.4.
+    const auto anova = SampleStatistics::getOneWayAnova({{1, 3}, {2, 4, 6}});
+    EXPECT_DOUBLE_EQ(3.2, anova.grandMean);
+    EXPECT_EQ(1u, anova.betweenDegreesOfFreedom);
+    EXPECT_EQ(3u, anova.withinDegreesOfFreedom);
+    EXPECT_DOUBLE_EQ(10.0 / 3, anova.withinVariance);
+    EXPECT_DOUBLE_EQ((4.8 - 10.0 / 3) / 2.4, anova.betweenVariance);
+    EXPECT_DOUBLE_EQ(4.8 / (10.0 / 3), anova.fStatistic);
+}
+
+TEST(SampleStatisticsTest, givenRunMeansCloserThanWithinVarianceImpliesThenBetweenVarianceIsZero) {
+    const auto anova = SampleStatistics::getOneWayAnova({{1, 5}, {2, 4}});
+    EXPECT_DOUBLE_EQ(3.0, anova.grandMean);
+    EXPECT_DOUBLE_EQ(0.0, anova.betweenVariance);
+    EXPECT_DOUBLE_EQ(0.0, anova.fStatistic);
+}
+
+TEST(SampleStatisticsTest, givenSingleGroupThenOnlyGrandMeanIsComputed) {
+    const auto anova = SampleStatistics::getOneWayAnova({{1, 2, 6}});
+    EXPECT_DOUBLE_EQ(3.0, anova.grandMean);
+    EXPECT_EQ(0u, anova.betweenDegreesOfFreedom);
+    EXPECT_EQ(0u, anova.withinDegreesOfFreedom);
+    EXPECT_DOUBLE_EQ(0.0, anova.withinVariance);
+    EXPECT_DOUBLE_EQ(0.0, anova.betweenVariance);
+}